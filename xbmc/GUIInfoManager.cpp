@@ -832,6 +832,16 @@ const infomap integer_bools[] =  {{ "isequal",          INTEGER_IS_EQUAL },
 ///     @skinning_v20 **[New Infolabel]** \link Player_HasSceneMarkers `Player.HasSceneMarkers`\endlink
 ///     <p>
 ///   }
+///   \table_row3{   <b>`Player.SeekPreview`</b>,
+///                  \anchor Player_SeekPreview
+///                  _string_,
+///     @return The image of the position a seek in the currently playing video goes to\, taken
+///     from the trickplay thumbnails of the video. Empty if no seek is in progress or the
+///     thumbnails were not generated before playback started.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link Player_SeekPreview `Player.SeekPreview`\endlink
+///     <p>
+///   }
 ///   \table_row3{   <b>`Player.Chapters`</b>,
 ///                  \anchor Player_Chapters
 ///                  _string_,
@@ -913,6 +923,7 @@ const infomap player_labels[] = {{"hasmedia", PLAYER_HAS_MEDIA},
                                  {"cuts", PLAYER_CUTS},
                                  {"scenemarkers", PLAYER_SCENE_MARKERS},
                                  {"hasscenemarkers", PLAYER_HAS_SCENE_MARKERS},
+                                 {"seekpreview", PLAYER_SEEKPREVIEW},
                                  {"chapters", PLAYER_CHAPTERS}};
 
 /// \page modules__infolabels_boolean_conditions
@@ -11647,6 +11658,36 @@ void CGUIInfoManager::ResetCache()
   // mark our infobools as dirty
   std::unique_lock<CCriticalSection> lock(m_critInfo);
   ++m_refreshCounter;
+  ++m_cacheResetCounter;
+}
+
+void CGUIInfoManager::ResetFrameCache()
+{
+  m_evaluationsLastFrame = m_evaluations.exchange(0, std::memory_order_relaxed);
+
+  // mark our polled infobools as dirty
+  std::unique_lock<CCriticalSection> lock(m_critInfo);
+  ++m_refreshCounter;
+}
+
+const GUIINFO::InfoChangeCounter* CGUIInfoManager::GetChangeCounter(int condition) const
+{
+  condition = std::abs(condition);
+
+  if (condition >= LISTITEM_START && condition < LISTITEM_END)
+    return nullptr;
+
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+  {
+    const CGUIInfo& info = m_multiInfo[condition - MULTI_INFO_START];
+    const int multiCondition = std::abs(info.m_info);
+    if (multiCondition >= LISTITEM_START && multiCondition <= LISTITEM_END)
+      return nullptr;
+
+    return m_infoProviders.GetChangeCounter(info);
+  }
+
+  return m_infoProviders.GetChangeCounter(CGUIInfo(condition));
 }
 
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag &tag)
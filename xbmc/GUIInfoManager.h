@@ -14,6 +14,7 @@
 #include "messaging/IMessageTarget.h"
 #include "threads/CriticalSection.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -62,8 +63,17 @@ public:
   void Initialize();
 
   void Clear();
+
+  /*! \brief Mark all infobools as dirty, including those driven by change notifications
+   */
   void ResetCache();
 
+  /*! \brief Mark the infobools that have to be polled as dirty, called once per frame
+   Infobools whose inputs are all driven by change notifications keep their values until
+   one of the inputs changes.
+   */
+  void ResetFrameCache();
+
   // KODI::MESSAGING::IMessageTarget implementation
   int GetMessageMask() override;
   void OnApplicationMessage(KODI::MESSAGING::ThreadMessage* pMsg) override;
@@ -157,6 +167,27 @@ public:
    */
   KODI::GUILIB::GUIINFO::CGUIInfoProviders& GetInfoProviders() { return m_infoProviders; }
 
+  /*! \brief Get the counter that is increased whenever the value of a boolean condition changes
+   \param condition the condition id, as returned by TranslateString
+   \return the change counter, or nullptr if the condition has to be polled
+   */
+  const KODI::GUILIB::GUIINFO::InfoChangeCounter* GetChangeCounter(int condition) const;
+
+  /*! \brief Get the counter that is increased by every ResetCache() call
+   */
+  const KODI::GUILIB::GUIINFO::InfoChangeCounter& GetCacheResetCounter() const
+  {
+    return m_cacheResetCounter;
+  }
+
+  /*! \brief Count an evaluation of an infobool, for the debug overlay
+   */
+  void CountEvaluation() { m_evaluations.fetch_add(1, std::memory_order_relaxed); }
+
+  /*! \brief Get the number of infobool evaluations during the last frame
+   */
+  unsigned int GetEvaluationsLastFrame() const { return m_evaluationsLastFrame; }
+
 private:
   /*! \brief class for holding information on properties
    */
@@ -221,6 +252,9 @@ private:
   typedef std::set<INFO::InfoPtr, bool(*)(const INFO::InfoPtr&, const INFO::InfoPtr&)> INFOBOOLTYPE;
   INFOBOOLTYPE m_bools;
   unsigned int m_refreshCounter = 0;
+  KODI::GUILIB::GUIINFO::InfoChangeCounter m_cacheResetCounter{0};
+  std::atomic<unsigned int> m_evaluations{0};
+  std::atomic<unsigned int> m_evaluationsLastFrame{0};
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
@@ -13,6 +13,8 @@
 #include "commons/ilog.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/Texture.h"
+#include "imagefiles/ImageFileURL.h"
+#include "imagefiles/SpecialImageLoaderFactory.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/JobManager.h"
@@ -43,6 +45,23 @@ bool CImageLoader::DoWork()
   if (texturePath.empty())
     return false;
 
+  const IMAGE_FILES::CImageFileURL imageURL{texturePath};
+  if (m_use_cache && imageURL.IsSpecialImage())
+  {
+    const IMAGE_FILES::CSpecialImageLoaderFactory specialImageLoader{};
+    if (!specialImageLoader.IsCacheable(imageURL))
+    {
+      m_texture = specialImageLoader.Load(imageURL);
+      if (!m_texture)
+        return false;
+
+      if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAsyncTextureUpload)
+        m_texture->LoadToGPUAsync();
+
+      return true;
+    }
+  }
+
   if (m_use_cache)
     loadPath = CServiceBroker::GetTextureCache()->CheckCachedImage(texturePath, needsChecking);
   else
@@ -118,6 +118,11 @@ bool CPlayListPlayer::OnMessage(CGUIMessage &message)
       m_bPlaybackStarted = true;
     }
     break;
+  case GUI_MSG_PRELOAD_NEXT_ITEM:
+    {
+      PreloadNextItem();
+    }
+    break;
   }
 
   return false;
@@ -189,6 +194,30 @@ int CPlayListPlayer::GetNextItemIdx()
   return iSong;
 }
 
+void CPlayListPlayer::PreloadNextItem()
+{
+  const int next = GetNextItemIdx(1);
+  if (next < 0 || next == m_iCurrentSong)
+    return;
+
+  const CPlayList& playlist = GetPlaylist(m_iCurrentPlayList);
+  if (next >= playlist.size())
+    return;
+
+  // plugins resolve their path on play, only plain video files are worth opening ahead
+  const CFileItemPtr item = playlist[next];
+  if (!IsVideo(*item) || item->IsPlugin() || IsPlayList(*item) ||
+      item->GetProperty("unplayable").asBoolean())
+    return;
+
+  CLog::Log(LOGDEBUG, "Playlist Player: preloading item: {}, path [{}]", next,
+            CURL::GetRedacted(item->GetDynPath()));
+
+  auto& components = CServiceBroker::GetAppComponents();
+  const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+  appPlayer->PreloadNextFile(*item);
+}
+
 bool CPlayListPlayer::PlayNext(int offset, bool bAutoPlay)
 {
   int iSong = GetNextItemIdx(offset);
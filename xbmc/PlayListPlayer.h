@@ -187,6 +187,10 @@ protected:
 
   void ReShuffle(Id playlistId, int iPosition);
 
+  /*! \brief Have the player open the next item of the current playlist ahead of time
+   */
+  void PreloadNextItem();
+
   void AnnouncePropertyChanged(Id playlistId,
                                const std::string& strProperty,
                                const CVariant& value);
@@ -75,6 +75,7 @@
 #include "guilib/GUIAudioManager.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlProfiler.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/LocalizeStrings.h"
@@ -795,6 +796,8 @@ void CApplication::Render()
   if (m_bStop)
     return;
 
+  GUIFRAMEPROFILER_SCOPE("Application::Render");
+
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   const auto appPower = GetComponent<CApplicationPowerHandling>();
 
@@ -846,7 +849,7 @@ void CApplication::Render()
   // fresh for the next process(), or after a windowclose animation (where process()
   // isn't called)
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
-  infoMgr.ResetCache();
+  infoMgr.ResetFrameCache();
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 
   if (hasRendered)
@@ -858,6 +861,8 @@ void CApplication::Render()
                                                        appPlayer->IsRenderingVideoLayer());
 
   CTimeUtils::UpdateFrameTime(hasRendered);
+
+  CGUIFrameProfiler::GetInstance().EndFrame();
 }
 
 bool CApplication::OnAction(const CAction &action)
@@ -1368,6 +1373,18 @@ bool CApplication::OnAction(const CAction &action)
     CGUIControlProfiler::Instance().Start();
     return true;
   }
+  if (action.GetID() == ACTION_FRAMEPROFILE_TOGGLE)
+  {
+    CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+    if (CGUIFrameProfiler::IsRunning())
+    {
+      profiler.Stop();
+      profiler.SaveTrace(CSpecialProtocol::TranslatePath("special://home/frameprofile.json"));
+    }
+    else
+      profiler.Start();
+    return true;
+  }
   if (action.GetID() == ACTION_SHOW_PLAYLIST)
   {
     const PLAYLIST::Id playlistId = CServiceBroker::GetPlaylistPlayer().GetCurrentPlaylist();
@@ -3152,6 +3169,8 @@ void CApplication::ConfigureAndEnableAddons()
 
 void CApplication::Process()
 {
+  GUIFRAMEPROFILER_SCOPE("Application::Process");
+
   // dispatch the messages generated by python or other threads to the current window
   CServiceBroker::GetGUI()->GetWindowManager().DispatchThreadMessages();
 
@@ -561,6 +561,13 @@ bool CApplicationPlayer::QueueNextFile(const CFileItem &file)
   return (player && player->QueueNextFile(file));
 }
 
+void CApplicationPlayer::PreloadNextFile(const CFileItem& file)
+{
+  std::shared_ptr<IPlayer> player = GetInternal();
+  if (player)
+    player->PreloadNextFile(file);
+}
+
 bool CApplicationPlayer::SetPlayerState(const std::string& state)
 {
   std::shared_ptr<IPlayer> player = GetInternal();
@@ -990,6 +997,15 @@ bool CApplicationPlayer::RenderCaptureGetPixels(unsigned int captureId, unsigned
     return false;
 }
 
+bool CApplicationPlayer::GetRenderTelemetry(std::vector<RenderFrameTelemetry>& frames) const
+{
+  const std::shared_ptr<const IPlayer> player = GetInternal();
+  if (player)
+    return player->GetRenderTelemetry(frames);
+  else
+    return false;
+}
+
 bool CApplicationPlayer::IsExternalPlaying() const
 {
   const std::shared_ptr<const IPlayer> player = GetInternal();
@@ -26,6 +26,7 @@ class CPlayerOptions;
 class CStreamDetails;
 
 struct AudioStreamInfo;
+struct RenderFrameTelemetry;
 struct VideoStreamInfo;
 struct SubtitleStreamInfo;
 struct TextCacheStruct_t;
@@ -69,6 +70,7 @@ public:
   void RenderCapture(unsigned int captureId, unsigned int width, unsigned int height, int flags = 0);
   void RenderCaptureRelease(unsigned int captureId);
   bool RenderCaptureGetPixels(unsigned int captureId, unsigned int millis, uint8_t *buffer, unsigned int size);
+  bool GetRenderTelemetry(std::vector<RenderFrameTelemetry>& frames) const;
   bool IsExternalPlaying() const;
   bool IsRemotePlaying() const;
 
@@ -140,6 +142,7 @@ public:
   bool OnAction(const CAction &action);
   void OnNothingToQueueNotify();
   void Pause();
+  void PreloadNextFile(const CFileItem& file);
   bool QueueNextFile(const CFileItem &file);
   void Seek(bool bPlus = true, bool bLargeStep = false, bool bChapterOverride = false);
   int SeekChapter(int iChapter);
@@ -221,6 +221,12 @@ void CApplicationPlayerCallback::OnQueueNextItem()
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
 
+void CApplicationPlayerCallback::OnPreloadNextItem()
+{
+  CGUIMessage msg(GUI_MSG_PRELOAD_NEXT_ITEM, 0, 0);
+  CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
+}
+
 void CApplicationPlayerCallback::OnPlayBackSeek(int64_t iTime, int64_t seekOffset)
 {
 #ifdef HAS_PYTHON
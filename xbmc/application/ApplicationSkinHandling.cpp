@@ -126,6 +126,7 @@ bool CApplicationSkinHandling::LoadSkin(const std::string& skinID)
   CLog::Log(LOGINFO, "  load skin from: {} (version: {})", skin->Path(),
             skin->Version().asString());
   g_SkinInfo = skin;
+  CSkinSettings::NotifySettingsChanged();
 
   CLog::Log(LOGINFO, "  load fonts for skin...");
   CServiceBroker::GetWinSystem()->GetGfxContext().SetMediaDir(skin->Path());
@@ -23,6 +23,7 @@
 #define CAPTUREFLAG_IMMEDIATELY 0x02 //read out immediately after render, this can cause a busy wait
 #define CAPTUREFORMAT_BGRA 0x01
 
+struct RenderFrameTelemetry;
 struct TextCacheStruct_t;
 class TiXmlElement;
 class CStreamDetails;
@@ -96,6 +97,11 @@ public:
   virtual bool OpenFile(const CFileItem& file, const CPlayerOptions& options){ return false;}
   virtual bool QueueNextFile(const CFileItem &file) { return false; }
   virtual void OnNothingToQueueNotify() {}
+  /*!
+   \brief Hint at the item that is played next, for the player to open it ahead of time.
+   Unlike QueueNextFile the player does not play the item on its own.
+   */
+  virtual void PreloadNextFile(const CFileItem& file) {}
   virtual bool CloseFile(bool reopen = false) = 0;
   virtual bool IsPlaying() const { return false;}
   virtual bool CanPause() const { return true; }
@@ -269,6 +275,14 @@ public:
     return false;
   }
 
+  /*!
+   \brief Get the timings of the most recently rendered video pictures, oldest first
+   */
+  virtual bool GetRenderTelemetry(std::vector<RenderFrameTelemetry>& frames) const
+  {
+    return false;
+  }
+
   // video and audio settings
   virtual CVideoSettings GetVideoSettings() const { return CVideoSettings(); }
   virtual void SetVideoSettings(CVideoSettings& settings) {}
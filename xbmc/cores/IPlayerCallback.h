@@ -27,6 +27,7 @@ public:
   virtual void OnPlayBackStopped() = 0;
   virtual void OnPlayBackError() = 0;
   virtual void OnQueueNextItem() = 0;
+  virtual void OnPreloadNextItem() {}
   virtual void OnPlayBackSeek(int64_t iTime, int64_t seekOffset) {}
   virtual void OnPlayBackSeekChapter(int iChapter) {}
   virtual void OnPlayBackSpeedChanged(int iSpeed) {}
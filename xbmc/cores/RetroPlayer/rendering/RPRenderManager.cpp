@@ -482,6 +482,9 @@ void CRPRenderManager::RenderInternal(const std::shared_ptr<CRPBaseRenderer>& re
                                       bool bClear,
                                       uint32_t alpha)
 {
+  // draw the GUI batched so far before the game renders on top of it
+  m_renderContext.FlushGUIBatch();
+
   renderer->PreRender(bClear);
 
   CSingleExit exitLock(m_renderContext.GraphicsMutex());
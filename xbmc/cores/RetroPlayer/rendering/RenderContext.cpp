@@ -66,6 +66,11 @@ void CRenderContext::ApplyStateBlock()
   m_rendering->ApplyStateBlock();
 }
 
+void CRenderContext::FlushGUIBatch()
+{
+  m_rendering->FlushGUIBatch();
+}
+
 bool CRenderContext::IsExtSupported(const char* extension)
 {
   return m_rendering->IsExtSupported(extension);
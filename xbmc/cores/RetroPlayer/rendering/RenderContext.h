@@ -61,6 +61,7 @@ public:
   void GetViewPort(CRect& viewPort);
   void SetScissors(const CRect& rect);
   void ApplyStateBlock();
+  void FlushGUIBatch();
   bool IsExtSupported(const char* extension);
 
   // OpenGL(ES) rendering functions
@@ -21,11 +21,16 @@
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
 #include "utils/StringUtils.h"
+#include "utils/TimeUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
+#include <utility>
 
 extern "C" {
 #include <libavfilter/avfilter.h>
@@ -53,6 +58,32 @@ enum DecoderState
   STATE_SW_MULTI
 };
 
+namespace
+{
+constexpr int MAX_DECODER_THREADS = 16;
+//! number of decoded frames the decode time is averaged over
+constexpr int THREADING_EVALUATION_FRAMES = 120;
+//! share of the frame period the decoder may use before more threads are added
+constexpr double THREADING_HIGH_LOAD = 0.75;
+//! share of the frame period below which threads are released again
+constexpr double THREADING_LOW_LOAD = 0.2;
+
+using ThreadingKey = std::tuple<AVCodecID, int, bool>;
+
+/*!
+ * Thread counts measured to suffice for previous streams, by codec, height class and
+ * whether the stream is realtime. They are applied when the next stream is opened.
+ */
+std::map<ThreadingKey, int> learnedThreadCounts;
+std::mutex learnedThreadingLock;
+
+ThreadingKey GetThreadingKey(const CDVDStreamInfo& hints, bool realtime)
+{
+  const int heightClass = hints.height <= 576 ? 0 : (hints.height <= 1088 ? 1 : 2);
+  return {hints.codec, heightClass, realtime};
+}
+} // namespace
+
 enum EFilterFlags {
   FILTER_NONE                =  0x0,
   FILTER_DEINTERLACE_BWDIF   =  0x1,  //< use first deinterlace mode
@@ -383,12 +414,8 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      SetupThreading(pCodec);
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
     }
   }
   else
@@ -466,6 +493,91 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
   return true;
 }
 
+void CDVDVideoCodecFFmpeg::SetupThreading(const AVCodec* codec)
+{
+  m_threading.m_canFrameThread = (codec->capabilities & AV_CODEC_CAP_FRAME_THREADS) != 0;
+  m_threading.m_canSliceThread = (codec->capabilities & AV_CODEC_CAP_SLICE_THREADS) != 0;
+
+  const int cpuCount = std::max(1, CServiceBroker::GetCPUInfo()->GetCPUCount());
+  m_threading.m_maxThreads = std::clamp(cpuCount * 3 / 2, 1, MAX_DECODER_THREADS);
+  m_threading.ResetStats();
+
+  // frame threading scales with the thread count, broadcast streams often have a single
+  // slice per frame and wouldn't be threaded at all otherwise
+  m_threading.m_threadType =
+      m_threading.m_canFrameThread || !m_threading.m_canSliceThread ? FF_THREAD_FRAME
+                                                                     : FF_THREAD_SLICE;
+
+  // start with all threads until a stream of the kind has shown it needs fewer
+  m_threading.m_threadCount = m_threading.m_maxThreads;
+  {
+    std::unique_lock<std::mutex> lock(learnedThreadingLock);
+    auto it =
+        learnedThreadCounts.find(GetThreadingKey(m_hints, m_processInfo.IsRealtimeStream()));
+    if (it != learnedThreadCounts.end())
+      m_threading.m_threadCount = std::clamp(it->second, 1, m_threading.m_maxThreads);
+  }
+
+  m_pCodecContext->thread_type = m_threading.m_threadType;
+  m_pCodecContext->thread_count = m_threading.m_threadCount;
+
+  CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open {} threaded with {} threads",
+            m_threading.m_threadType == FF_THREAD_SLICE ? "slice" : "frame",
+            m_threading.m_threadCount);
+}
+
+void CDVDVideoCodecFFmpeg::UpdateThreading()
+{
+  // only judge the decoder by frames that were decoded at normal speed
+  if (m_pCodecContext->skip_frame > AVDISCARD_DEFAULT)
+  {
+    m_threading.ResetStats();
+    return;
+  }
+
+  if (++m_threading.m_decodedFrames < THREADING_EVALUATION_FRAMES)
+    return;
+
+  float fps = m_processInfo.GetVideoFps();
+  if (fps <= 0.0f && m_hints.fpsrate > 0 && m_hints.fpsscale > 0)
+    fps = static_cast<float>(m_hints.fpsrate) / m_hints.fpsscale;
+
+  const double frameTime = static_cast<double>(m_threading.m_decodeTime) /
+                           CurrentHostFrequency() / m_threading.m_decodedFrames;
+  m_threading.ResetStats();
+
+  if (fps <= 0.0f)
+    return;
+
+  // share of the frame period the player thread spent waiting for the decoder
+  const double load = frameTime * fps;
+
+  int threadCount = m_threading.m_threadCount;
+  if (load > THREADING_HIGH_LOAD)
+    threadCount = std::min(m_threading.m_maxThreads, threadCount + std::max(1, threadCount / 2));
+  else if (load < THREADING_LOW_LOAD && threadCount > 2)
+    threadCount = std::max(2, threadCount * 2 / 3);
+
+  if (threadCount == m_threading.m_threadCount)
+    return;
+
+  // reopening the decoder mid-stream would replay the buffered packets and flush the
+  // render buffers, the count is only used from the next Open() on
+  CLog::Log(LOGDEBUG,
+            "CDVDVideoCodecFFmpeg - decoding takes {:.1f} ms per frame at {:.3f} fps with {} "
+            "threads, using {} threads from the next open",
+            frameTime * 1000.0, fps, m_threading.m_threadCount, threadCount);
+
+  std::unique_lock<std::mutex> lock(learnedThreadingLock);
+  learnedThreadCounts[GetThreadingKey(m_hints, m_processInfo.IsRealtimeStream())] = threadCount;
+}
+
+void CDVDVideoCodecFFmpeg::CThreadingControl::ResetStats()
+{
+  m_decodeTime = 0;
+  m_decodedFrames = 0;
+}
+
 void CDVDVideoCodecFFmpeg::Dispose()
 {
   av_frame_free(&m_pFrame);
@@ -548,7 +660,14 @@ void CDVDVideoCodecFFmpeg::UpdateName()
   if(m_pHardware)
     m_name += "-" + m_pHardware->Name();
 
-  m_processInfo.SetVideoDecoderName(m_name, m_pHardware ? true : false);
+  // show the threading in the player debug info, the codec name itself stays untouched
+  std::string decoderName = m_name;
+  if (m_decoderState == STATE_SW_MULTI && !m_pHardware)
+    decoderName += StringUtils::Format(
+        " ({}x{})", m_threading.m_threadType == FF_THREAD_SLICE ? "slice" : "frame",
+        m_threading.m_threadCount);
+
+  m_processInfo.SetVideoDecoderName(decoderName, m_pHardware ? true : false);
 
   CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - Updated codec: {}", m_name);
 }
@@ -609,7 +728,9 @@ bool CDVDVideoCodecFFmpeg::AddData(const DemuxPacket &packet)
   avpkt->side_data = static_cast<AVPacketSideData*>(packet.pSideData);
   avpkt->side_data_elems = packet.iSideDataElems;
 
+  const int64_t decodeStart = CurrentHostCounter();
   int ret = avcodec_send_packet(m_pCodecContext, avpkt);
+  m_threading.AddDecodeTime(CurrentHostCounter() - decodeStart);
 
   //! @todo: properly handle avpkt side_data. this works around our improper use of the side_data
   // as we pass pointers to ffmpeg allocated memory for the side_data. we should really be allocating
@@ -710,7 +831,9 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
     av_packet_free(&avpkt);
   }
 
+  const int64_t decodeStart = CurrentHostCounter();
   int ret = avcodec_receive_frame(m_pCodecContext, m_pDecodedFrame);
+  m_threading.AddDecodeTime(CurrentHostCounter() - decodeStart);
 
   if (m_decoderState == STATE_HW_FAILED && !m_pHardware)
     return VC_REOPEN;
@@ -850,6 +973,9 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
   // process filters for sw decoding
   else
   {
+    if (m_decoderState == STATE_SW_MULTI)
+      UpdateThreading();
+
     SetFilters();
 
     bool need_scale = std::find(m_formats.begin(),
@@ -944,6 +1070,7 @@ void CDVDVideoCodecFFmpeg::Reset()
   m_filters = "";
   FilterClose();
   m_dropCtrl.Reset(false);
+  m_threading.ResetStats();
 }
 
 void CDVDVideoCodecFFmpeg::Reopen()
@@ -1184,6 +1311,17 @@ int CDVDVideoCodecFFmpeg::FilterOpen(const std::string& filters, bool scale)
     return -1;
   }
 
+  // deinterlacers like bwdif and yadif are slice threaded, so they don't serialise
+  // with the decoder on a single core. The scaler that converts to a format the
+  // renderer supports runs its own slice threads. Both get the cores the decoder threads
+  // leave, so the two don't contend for the same cores.
+  const int cpuCount = std::max(1, CServiceBroker::GetCPUInfo()->GetCPUCount());
+  const int filterThreads =
+      std::clamp(cpuCount - m_threading.m_threadCount, 1, MAX_DECODER_THREADS);
+  m_pFilterGraph->thread_type = AVFILTER_THREAD_SLICE;
+  m_pFilterGraph->nb_threads = filterThreads;
+  m_pFilterGraph->scale_sws_opts = av_strdup(StringUtils::Format("threads={}", filterThreads).c_str());
+
   const AVFilter* srcFilter = avfilter_get_by_name("buffer");
   const AVFilter* outFilter = avfilter_get_by_name("buffersink"); // should be last filter in the graph for now
 
@@ -1263,6 +1401,9 @@ int CDVDVideoCodecFFmpeg::FilterOpen(const std::string& filters, bool scale)
     return result;
   }
 
+  CLog::Log(LOGDEBUG, LOGVIDEO, "CDVDVideoCodecFFmpeg::FilterOpen - filters use {} threads",
+            filterThreads);
+
   if (CServiceBroker::GetLogging().CanLogComponent(LOGVIDEO))
   {
     char* graphDump = avfilter_graph_dump(m_pFilterGraph, nullptr);
@@ -1377,7 +1518,13 @@ void CDVDVideoCodecFFmpeg::SetCodecControl(int flags)
     else
       m_requestSkipDeint = false;
 
-    if (bDrop)
+    if (flags & DVD_CODEC_CTRL_KEYFRAMES)
+    {
+      m_pCodecContext->skip_frame = AVDISCARD_NONKEY;
+      m_pCodecContext->skip_idct = AVDISCARD_DEFAULT;
+      m_pCodecContext->skip_loop_filter = AVDISCARD_DEFAULT;
+    }
+    else if (bDrop)
     {
       m_pCodecContext->skip_frame = AVDISCARD_NONREF;
       m_pCodecContext->skip_idct = AVDISCARD_NONREF;
@@ -59,6 +59,9 @@ protected:
   bool HasHardware() { return m_pHardware != nullptr; }
   void SetHardware(IHardwareDecoder *hardware);
 
+  void SetupThreading(const AVCodec* codec);
+  void UpdateThreading();
+
   AVFrame* m_pFrame = nullptr;;
   AVFrame* m_pDecodedFrame = nullptr;;
   AVCodecContext* m_pCodecContext = nullptr;;
@@ -114,4 +117,22 @@ protected:
       VALID
     } m_state;
   } m_dropCtrl;
+
+  /*!
+   * @brief Threading of the software decoder, the thread count is adapted to the measured
+   * decode time of previous streams
+   */
+  struct CThreadingControl
+  {
+    void ResetStats();
+    void AddDecodeTime(int64_t ticks) { m_decodeTime += ticks; }
+
+    int m_threadType = 0; //!< FF_THREAD_FRAME or FF_THREAD_SLICE
+    int m_threadCount = 1;
+    int m_maxThreads = 1;
+    bool m_canFrameThread = false;
+    bool m_canSliceThread = false;
+    int64_t m_decodeTime = 0; //!< time spent in the decoder since the last evaluation
+    int m_decodedFrames = 0;
+  } m_threading;
 };
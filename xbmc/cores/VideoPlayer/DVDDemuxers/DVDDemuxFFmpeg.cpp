@@ -664,6 +664,8 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   m_startTime = 0;
   m_seekStream = -1;
 
+  OpenKeyframeIndex();
+
   return true;
 }
 
@@ -672,6 +674,11 @@ void CDVDDemuxFFmpeg::Dispose()
   m_pkt.result = -1;
   av_packet_unref(&m_pkt.pkt);
 
+  if (m_keyframeIndexStream >= 0)
+    m_keyframeIndex.Save(m_pInput->GetFileName());
+  m_keyframeIndex.Clear();
+  m_keyframeIndexStream = -1;
+
   delete m_pSSIF;
   m_pSSIF = nullptr;
 
@@ -1058,6 +1065,8 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
       }
       else if (m_pkt.result == AVERROR_EOF)
       {
+        if (m_keyframeIndexStream >= 0 && m_keyframeIndexContiguous)
+          m_keyframeIndex.SetComplete();
       }
       else if (m_pkt.result < 0)
       {
@@ -1180,6 +1189,9 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               (pPacket->pts > m_currentPts || m_currentPts == DVD_NOPTS_VALUE))
             m_currentPts = pPacket->pts;
 
+          if (m_pkt.pkt.stream_index == m_keyframeIndexStream)
+            AddKeyframe(stream);
+
           // store internal id until we know the continuous id presented to player
           // the stream might not have been created yet
           pPacket->iStreamId = m_pkt.pkt.stream_index;
@@ -1352,10 +1364,31 @@ bool CDVDDemuxFFmpeg::SeekTime(double time, bool backwards, double* startpts)
   else if (m_pFormatContext->start_time != (int64_t)AV_NOPTS_VALUE && !ismp3 && !m_bSup)
     seek_pts += m_pFormatContext->start_time;
 
-  int ret;
+  int ret = -1;
   {
     std::unique_lock<CCriticalSection> lock(m_critSection);
-    ret = av_seek_frame(m_pFormatContext, m_seekStream, seek_pts, backwards ? AVSEEK_FLAG_BACKWARD : 0);
+    m_keyframeIndexContiguous = false;
+
+    // the index spares the demuxer bisecting files it has no index for
+    CDemuxKeyframeIndex::Sample keyframe;
+    if (m_keyframeIndexStream >= 0)
+    {
+      const int64_t indexTime =
+          m_checkTransportStream
+              ? av_rescale_q(seek_pts, m_pFormatContext->streams[m_seekStream]->time_base,
+                             AVRational{1, 1000})
+              : seek_pts / (AV_TIME_BASE / 1000);
+      if (m_keyframeIndex.Find(indexTime, backwards, keyframe))
+      {
+        ret = av_seek_frame(m_pFormatContext, -1, keyframe.pos, AVSEEK_FLAG_BYTE);
+        CLog::Log(LOGDEBUG, "{} - seek to indexed keyframe at {} ms, pos {}: {}", __FUNCTION__,
+                  keyframe.time, keyframe.pos, ret);
+      }
+    }
+
+    if (ret < 0)
+      ret = av_seek_frame(m_pFormatContext, m_seekStream, seek_pts,
+                          backwards ? AVSEEK_FLAG_BACKWARD : 0);
 
     if (ret < 0)
     {
@@ -1432,6 +1465,7 @@ bool CDVDDemuxFFmpeg::SeekTime(double time, bool backwards, double* startpts)
 bool CDVDDemuxFFmpeg::SeekByte(int64_t pos)
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_keyframeIndexContiguous = false;
   int ret = av_seek_frame(m_pFormatContext, -1, pos, AVSEEK_FLAG_BYTE);
 
   if (ret >= 0)
@@ -1443,6 +1477,86 @@ bool CDVDDemuxFFmpeg::SeekByte(int64_t pos)
   return (ret >= 0);
 }
 
+bool CDVDDemuxFFmpeg::NeedsKeyframeIndex() const
+{
+  return m_keyframeIndexStream >= 0 && !m_keyframeIndex.IsComplete();
+}
+
+void CDVDDemuxFFmpeg::OpenKeyframeIndex()
+{
+  m_keyframeIndex.Clear();
+  m_keyframeIndexStream = -1;
+  m_keyframeIndexContiguous = true;
+
+  // only local or network files can be indexed, streams and discs have their own means
+  if (!m_pInput->IsStreamType(DVDSTREAM_TYPE_FILE) || m_pInput->IsRealtime() || m_pSSIF ||
+      !m_pInput->Seek(0, SEEK_POSSIBLE) || (m_pFormatContext->iformat->flags & AVFMT_NO_BYTE_SEEK))
+    return;
+
+  const int64_t fileSize = m_pInput->GetLength();
+  if (fileSize <= 0)
+    return;
+
+  const int stream =
+      av_find_best_stream(m_pFormatContext, AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
+  if (stream < 0)
+    return;
+
+  // containers that carry an index of their own seek well without ours
+  const char* name = m_pFormatContext->iformat->name;
+  if (m_bMatroska)
+  {
+    if (avformat_index_get_entries_count(m_pFormatContext->streams[stream]) > 1)
+      return;
+  }
+  else if (strcmp(name, "mpegts") != 0 && strcmp(name, "mpeg") != 0 &&
+           strcmp(name, "h264") != 0 && strcmp(name, "hevc") != 0 &&
+           strcmp(name, "mpegvideo") != 0 && strcmp(name, "vc1") != 0)
+    return;
+
+  const std::string& fileName = m_pInput->GetFileName();
+  struct __stat64 st = {};
+  const int64_t fileTime =
+      XFILE::CFile::Stat(fileName, &st) == 0 ? static_cast<int64_t>(st.st_mtime) : 0;
+
+  if (m_keyframeIndex.Load(fileName) &&
+      (m_keyframeIndex.GetFileSize() != fileSize || m_keyframeIndex.GetFileTime() != fileTime))
+  {
+    CLog::Log(LOGDEBUG, "{} - file changed, discarding keyframe index of {}", __FUNCTION__,
+              CURL::GetRedacted(fileName));
+    m_keyframeIndex.Clear();
+  }
+  m_keyframeIndex.SetFileSize(fileSize);
+  m_keyframeIndex.SetFileTime(fileTime);
+  m_keyframeIndexStream = stream;
+
+  CLog::Log(LOGDEBUG, "{} - keyframe index of {} has {} samples{}", __FUNCTION__,
+            CURL::GetRedacted(fileName), m_keyframeIndex.GetSamples().size(),
+            m_keyframeIndex.IsComplete() ? ", complete" : "");
+}
+
+void CDVDDemuxFFmpeg::AddKeyframe(const AVStream* stream)
+{
+  if (!(m_pkt.pkt.flags & AV_PKT_FLAG_KEY) || m_pkt.pkt.pos < 0)
+    return;
+
+  int64_t pts = m_pkt.pkt.pts != AV_NOPTS_VALUE ? m_pkt.pkt.pts : m_pkt.pkt.dts;
+  if (pts == AV_NOPTS_VALUE)
+    return;
+
+  // 33 bit MPEG timestamps wrap after about 26 hours, keep the index sorted past that point
+  if (stream->pts_wrap_bits > 0 && stream->pts_wrap_bits < 63 &&
+      stream->start_time != AV_NOPTS_VALUE)
+  {
+    const int64_t wrap = int64_t{1} << stream->pts_wrap_bits;
+    if (stream->start_time - pts > wrap / 2)
+      pts += wrap;
+  }
+
+  // raw stream time, the start time may be unknown when seeking in another opening of the file
+  m_keyframeIndex.Add(av_rescale_q(pts, stream->time_base, AVRational{1, 1000}), m_pkt.pkt.pos);
+}
+
 int CDVDDemuxFFmpeg::GetStreamLength()
 {
   if (!m_pFormatContext)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "DVDDemux.h"
+#include "DemuxKeyframeIndex.h"
 #include "DemuxStreamSSIF.h"
 #include "threads/CriticalSection.h"
 #include "threads/SystemClock.h"
@@ -113,6 +114,11 @@ public:
 
   bool Aborted();
 
+  /*!
+   \brief The file has no usable index of its own and the keyframe index doesn't cover it yet
+   */
+  bool NeedsKeyframeIndex() const;
+
   AVFormatContext* m_pFormatContext;
   std::shared_ptr<CDVDInputStream> m_pInput;
 
@@ -134,6 +140,8 @@ protected:
   double ConvertTimestamp(int64_t pts, int den, int num);
   bool IsProgramChange();
   unsigned int HLSSelectProgram();
+  void OpenKeyframeIndex();
+  void AddKeyframe(const AVStream* stream);
 
   std::string GetStereoModeFromMetadata(AVDictionary* pMetadata);
   std::string ConvertCodecToInternalStereoMode(const std::string& mode, const StereoModeConversionMap* conversionMap);
@@ -180,5 +188,9 @@ protected:
   double m_startTime = 0;
   bool m_dv_dual_stream = false;
   bool m_dv_dual_stream_started = false;
+
+  CDemuxKeyframeIndex m_keyframeIndex;
+  int m_keyframeIndexStream = -1; ///< video stream whose keyframes are indexed, -1 if not indexing
+  bool m_keyframeIndexContiguous = false; ///< read from the start without seeking
 };
 
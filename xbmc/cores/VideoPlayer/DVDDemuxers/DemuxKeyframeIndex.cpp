@@ -0,0 +1,238 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxKeyframeIndex.h"
+
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/File.h"
+#include "profiles/ProfileManager.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+constexpr char INDEX_MAGIC[4] = {'K', 'F', 'I', 'X'};
+constexpr uint32_t INDEX_VERSION = 2;
+
+// the header is magic, version, complete flag, file size, file time and number of samples
+constexpr size_t HEADER_SIZE = sizeof(INDEX_MAGIC) + sizeof(uint32_t) + sizeof(uint32_t) +
+                               sizeof(int64_t) + sizeof(int64_t) + sizeof(uint32_t);
+
+// a player and a background job may save the index of the same file
+std::mutex indexFileMutex;
+
+template<typename T>
+void Append(std::string& data, T value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template<typename T>
+T Extract(const std::string& data, size_t& offset)
+{
+  T value;
+  std::memcpy(&value, data.data() + offset, sizeof(value));
+  offset += sizeof(value);
+  return value;
+}
+
+bool CompareTime(const CDemuxKeyframeIndex::Sample& sample, int64_t time)
+{
+  return sample.time < time;
+}
+} // namespace
+
+void CDemuxKeyframeIndex::Clear()
+{
+  m_samples.clear();
+  m_fileSize = 0;
+  m_fileTime = 0;
+  m_complete = false;
+  m_modified = false;
+}
+
+void CDemuxKeyframeIndex::Add(int64_t time, int64_t pos)
+{
+  const auto it = std::lower_bound(m_samples.begin(), m_samples.end(), time, CompareTime);
+
+  if (it != m_samples.end() && it->time - time < MIN_INTERVAL)
+    return;
+  if (it != m_samples.begin() && time - std::prev(it)->time < MIN_INTERVAL)
+    return;
+
+  m_samples.insert(it, {time, pos});
+  m_modified = true;
+}
+
+bool CDemuxKeyframeIndex::Find(int64_t time, bool backwards, Sample& sample) const
+{
+  if (backwards)
+  {
+    auto it = std::upper_bound(m_samples.begin(), m_samples.end(), time,
+                               [](int64_t t, const Sample& s) { return t < s.time; });
+    if (it == m_samples.begin())
+      return false;
+
+    --it;
+    if (time - it->time > MAX_DISTANCE)
+      return false;
+
+    sample = *it;
+    return true;
+  }
+
+  const auto it = std::lower_bound(m_samples.begin(), m_samples.end(), time, CompareTime);
+  if (it == m_samples.end() || it->time - time > MAX_DISTANCE)
+    return false;
+
+  sample = *it;
+  return true;
+}
+
+void CDemuxKeyframeIndex::Merge(const CDemuxKeyframeIndex& other)
+{
+  const bool modified = m_modified;
+  for (const auto& sample : other.m_samples)
+    Add(sample.time, sample.pos);
+
+  m_complete |= other.m_complete;
+  m_modified = modified;
+}
+
+void CDemuxKeyframeIndex::SetComplete()
+{
+  if (!m_complete)
+    m_modified = true;
+  m_complete = true;
+}
+
+std::string CDemuxKeyframeIndex::Serialize() const
+{
+  std::string data;
+  data.reserve(HEADER_SIZE + m_samples.size() * sizeof(Sample));
+
+  data.append(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+  Append(data, INDEX_VERSION);
+  Append(data, static_cast<uint32_t>(m_complete ? 1 : 0));
+  Append(data, m_fileSize);
+  Append(data, m_fileTime);
+  Append(data, static_cast<uint32_t>(m_samples.size()));
+  for (const auto& sample : m_samples)
+  {
+    Append(data, sample.time);
+    Append(data, sample.pos);
+  }
+
+  return data;
+}
+
+bool CDemuxKeyframeIndex::Deserialize(const std::string& data)
+{
+  Clear();
+
+  if (data.size() < HEADER_SIZE || data.compare(0, sizeof(INDEX_MAGIC), INDEX_MAGIC,
+                                                sizeof(INDEX_MAGIC)) != 0)
+    return false;
+
+  size_t offset = sizeof(INDEX_MAGIC);
+  if (Extract<uint32_t>(data, offset) != INDEX_VERSION)
+    return false;
+
+  const bool complete = Extract<uint32_t>(data, offset) != 0;
+  const int64_t fileSize = Extract<int64_t>(data, offset);
+  const int64_t fileTime = Extract<int64_t>(data, offset);
+  const uint32_t count = Extract<uint32_t>(data, offset);
+  if (data.size() != HEADER_SIZE + static_cast<size_t>(count) * 2 * sizeof(int64_t))
+    return false;
+
+  m_samples.reserve(count);
+  for (uint32_t i = 0; i < count; i++)
+  {
+    const int64_t time = Extract<int64_t>(data, offset);
+    const int64_t pos = Extract<int64_t>(data, offset);
+    if (!m_samples.empty() && time <= m_samples.back().time)
+    {
+      Clear();
+      return false;
+    }
+    m_samples.push_back({time, pos});
+  }
+
+  m_fileSize = fileSize;
+  m_fileTime = fileTime;
+  m_complete = complete;
+  return true;
+}
+
+bool CDemuxKeyframeIndex::Load(const std::string& mediaFile)
+{
+  std::vector<uint8_t> buffer;
+  {
+    std::unique_lock<std::mutex> lock(indexFileMutex);
+    XFILE::CFile file;
+    if (file.LoadFile(GetIndexPath(mediaFile), buffer) <= 0)
+      return false;
+  }
+
+  if (!Deserialize(std::string(buffer.begin(), buffer.end())))
+  {
+    CLog::Log(LOGDEBUG, "CDemuxKeyframeIndex::{} - discarding invalid index of {}", __FUNCTION__,
+              CURL::GetRedacted(mediaFile));
+    return false;
+  }
+
+  return true;
+}
+
+bool CDemuxKeyframeIndex::Save(const std::string& mediaFile)
+{
+  if (!m_modified)
+    return true;
+
+  const std::string path = GetIndexPath(mediaFile);
+  std::unique_lock<std::mutex> lock(indexFileMutex);
+
+  // keep what another opening of the file found meanwhile
+  std::vector<uint8_t> buffer;
+  XFILE::CFile file;
+  if (file.LoadFile(path, buffer) > 0)
+  {
+    CDemuxKeyframeIndex stored;
+    if (stored.Deserialize(std::string(buffer.begin(), buffer.end())) &&
+        stored.GetFileSize() == m_fileSize && stored.GetFileTime() == m_fileTime)
+      Merge(stored);
+  }
+  file.Close();
+
+  const std::string data = Serialize();
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::Log(LOGERROR, "CDemuxKeyframeIndex::{} - unable to write {}", __FUNCTION__, path);
+    return false;
+  }
+
+  m_modified = false;
+  return true;
+}
+
+std::string CDemuxKeyframeIndex::GetIndexPath(const std::string& mediaFile)
+{
+  const std::string folder =
+      CServiceBroker::GetSettingsComponent()->GetProfileManager()->GetKeyframesFolder();
+  return URIUtils::AddFileToFolder(
+      folder, StringUtils::Format("{:08x}.kfi", Crc32::ComputeFromLowerCase(mediaFile)));
+}
@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ \brief Compact index of keyframe positions of a media file.
+
+ Maps stream timestamps of video keyframes to the byte offset of their packet, so
+ a seek in files without a usable container index (MPEG-TS recordings, raw ES,
+ poorly muxed MKVs) can go to the right place in one read instead of bisecting the
+ file. Samples are kept at least MIN_INTERVAL apart to keep the index small.
+
+ Times are milliseconds of the raw stream timestamps, i.e. before any start time
+ of the container is subtracted, so indexes of different openings of a file match.
+ Timestamps that wrapped around are unwrapped by the demuxer before they are added.
+ */
+class CDemuxKeyframeIndex
+{
+public:
+  struct Sample
+  {
+    int64_t time; ///< milliseconds
+    int64_t pos; ///< byte offset of the keyframe packet
+  };
+
+  //! minimum time between two samples
+  static constexpr int64_t MIN_INTERVAL = 1000;
+  //! maximum time between a sample and the seek target for the sample to be used
+  static constexpr int64_t MAX_DISTANCE = 10000;
+
+  void Clear();
+
+  /*!
+   \brief Add a keyframe, ignored if another sample is closer than MIN_INTERVAL
+   */
+  void Add(int64_t time, int64_t pos);
+
+  /*!
+   \brief Find the sample to seek to for a time
+   \param time target in milliseconds
+   \param backwards return the last sample at or before the target instead of the
+          first one at or after it
+   \param[out] sample the sample found
+   \return false if the index has no sample within MAX_DISTANCE in that direction
+   */
+  bool Find(int64_t time, bool backwards, Sample& sample) const;
+
+  //! Add the samples of another index of the same file
+  void Merge(const CDemuxKeyframeIndex& other);
+
+  //! The whole file was read, seeks can rely on the index everywhere
+  void SetComplete();
+  bool IsComplete() const { return m_complete; }
+
+  //! Samples were added since the index was loaded
+  bool IsModified() const { return m_modified; }
+
+  //! Size of the indexed file, to tell whether a stored index still fits the file
+  void SetFileSize(int64_t size) { m_fileSize = size; }
+  int64_t GetFileSize() const { return m_fileSize; }
+
+  //! Modification time of the indexed file, a file rewritten at the same size gets a new index
+  void SetFileTime(int64_t time) { m_fileTime = time; }
+  int64_t GetFileTime() const { return m_fileTime; }
+
+  const std::vector<Sample>& GetSamples() const { return m_samples; }
+
+  std::string Serialize() const;
+  bool Deserialize(const std::string& data);
+
+  /*!
+   \brief Load the stored index of a media file
+   \param mediaFile path of the media file, not of the index
+   \return false if there is no usable stored index
+   */
+  bool Load(const std::string& mediaFile);
+
+  /*!
+   \brief Merge with the stored index of a media file and write it back
+   \param mediaFile path of the media file, not of the index
+   */
+  bool Save(const std::string& mediaFile);
+
+  static std::string GetIndexPath(const std::string& mediaFile);
+
+private:
+  std::vector<Sample> m_samples; ///< sorted by time
+  int64_t m_fileSize{0};
+  int64_t m_fileTime{0};
+  bool m_complete{false};
+  bool m_modified{false};
+};
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "KeyframeIndexJob.h"
+
+#include "DVDDemuxFFmpeg.h"
+#include "DVDDemuxUtils.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "utils/JobManager.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <mutex>
+#include <set>
+
+namespace
+{
+// paths with a job queued or running
+std::mutex queuedMutex;
+std::set<std::string> queued;
+} // namespace
+
+CKeyframeIndexJob::CKeyframeIndexJob(const CFileItem& item) : m_item(item)
+{
+}
+
+void CKeyframeIndexJob::Queue(const CFileItem& item)
+{
+  {
+    std::unique_lock<std::mutex> lock(queuedMutex);
+    if (!queued.insert(item.GetDynPath()).second)
+      return;
+  }
+
+  CServiceBroker::GetJobManager()->AddJob(new CKeyframeIndexJob(item), nullptr,
+                                          CJob::PRIORITY_LOW_PAUSABLE);
+}
+
+bool CKeyframeIndexJob::DoWork()
+{
+  const std::string path = m_item.GetDynPath();
+  const bool success = BuildIndex();
+
+  std::unique_lock<std::mutex> lock(queuedMutex);
+  queued.erase(path);
+
+  return success;
+}
+
+bool CKeyframeIndexJob::BuildIndex()
+{
+  auto input = CDVDFactoryInputStream::CreateInputStream(nullptr, m_item);
+  if (!input || !input->Open())
+    return false;
+
+  // the demuxer indexes what it reads and saves the index when it's closed
+  CDVDDemuxFFmpeg demuxer;
+  if (!demuxer.Open(input, false, true))
+    return false;
+
+  if (!demuxer.NeedsKeyframeIndex())
+    return true;
+
+  const std::string redactedPath = CURL::GetRedacted(m_item.GetDynPath());
+  CLog::Log(LOGDEBUG, "CKeyframeIndexJob::{} - indexing {}", __FUNCTION__, redactedPath);
+
+  const int64_t length = input->GetLength();
+  while (DemuxPacket* packet = demuxer.Read())
+  {
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+    // pausable jobs are paused as soon as playback starts, stay out of its way
+    if (!CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE) ||
+        ShouldCancel(static_cast<unsigned int>(input->GetPos() * 100 / length), 100))
+    {
+      CLog::Log(LOGDEBUG, "CKeyframeIndexJob::{} - stopped indexing {}", __FUNCTION__,
+                redactedPath);
+      return false;
+    }
+  }
+
+  return !demuxer.NeedsKeyframeIndex();
+}
+
+bool CKeyframeIndexJob::operator==(const CJob* job) const
+{
+  if (strcmp(job->GetType(), GetType()) != 0)
+    return false;
+
+  return static_cast<const CKeyframeIndexJob*>(job)->m_item.GetDynPath() == m_item.GetDynPath();
+}
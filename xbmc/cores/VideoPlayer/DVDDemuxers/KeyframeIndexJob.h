@@ -0,0 +1,38 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "FileItem.h"
+#include "utils/Job.h"
+
+/*!
+ \brief Reads a whole media file to complete its keyframe index.
+
+ Runs as a pausable job, so it waits while a video is playing and gives up as soon as
+ playback starts again. What was indexed until then is kept for the next attempt.
+ */
+class CKeyframeIndexJob : public CJob
+{
+public:
+  explicit CKeyframeIndexJob(const CFileItem& item);
+
+  /*!
+   \brief Queue a job for the item unless one is queued already
+   */
+  static void Queue(const CFileItem& item);
+
+  bool DoWork() override;
+  const char* GetType() const override { return "keyframeindex"; }
+  bool operator==(const CJob* job) const override;
+
+private:
+  bool BuildIndex();
+
+  CFileItem m_item;
+};
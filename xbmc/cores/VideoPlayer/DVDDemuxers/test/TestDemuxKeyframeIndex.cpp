@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DemuxKeyframeIndex.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestDemuxKeyframeIndex, KeepsSamplesApart)
+{
+  CDemuxKeyframeIndex index;
+  for (int64_t time = 0; time < 10000; time += 500)
+    index.Add(time, time * 10);
+
+  const auto& samples = index.GetSamples();
+  ASSERT_EQ(10u, samples.size());
+  for (size_t i = 1; i < samples.size(); i++)
+    EXPECT_GE(samples[i].time - samples[i - 1].time, CDemuxKeyframeIndex::MIN_INTERVAL);
+
+  // out of order keyframes end up sorted
+  index.Add(100000, 1000000);
+  index.Add(50000, 500000);
+  EXPECT_EQ(50000, samples[10].time);
+  EXPECT_EQ(100000, samples[11].time);
+}
+
+TEST(TestDemuxKeyframeIndex, FindsNearestSample)
+{
+  CDemuxKeyframeIndex index;
+  for (int64_t time = 1000; time <= 20000; time += 2000)
+    index.Add(time, time * 10);
+
+  CDemuxKeyframeIndex::Sample sample;
+  ASSERT_TRUE(index.Find(6000, true, sample));
+  EXPECT_EQ(5000, sample.time);
+  EXPECT_EQ(50000, sample.pos);
+
+  ASSERT_TRUE(index.Find(6000, false, sample));
+  EXPECT_EQ(7000, sample.time);
+
+  ASSERT_TRUE(index.Find(7000, true, sample));
+  EXPECT_EQ(7000, sample.time);
+
+  EXPECT_FALSE(index.Find(500, true, sample));
+  EXPECT_FALSE(index.Find(20000 + CDemuxKeyframeIndex::MAX_DISTANCE, false, sample));
+
+  // the index doesn't cover the end of the file yet
+  EXPECT_FALSE(index.Find(19000 + CDemuxKeyframeIndex::MAX_DISTANCE + 1, true, sample));
+}
+
+TEST(TestDemuxKeyframeIndex, SerializesAndMerges)
+{
+  CDemuxKeyframeIndex index;
+  index.SetFileSize(123456789);
+  index.SetFileTime(1700000000);
+  index.Add(0, 0);
+  index.Add(2000, 4096);
+  index.SetComplete();
+
+  CDemuxKeyframeIndex loaded;
+  ASSERT_TRUE(loaded.Deserialize(index.Serialize()));
+  EXPECT_EQ(123456789, loaded.GetFileSize());
+  EXPECT_EQ(1700000000, loaded.GetFileTime());
+  EXPECT_TRUE(loaded.IsComplete());
+  EXPECT_FALSE(loaded.IsModified());
+  ASSERT_EQ(2u, loaded.GetSamples().size());
+  EXPECT_EQ(4096, loaded.GetSamples()[1].pos);
+
+  CDemuxKeyframeIndex other;
+  other.Add(1000, 2048);
+  other.Merge(loaded);
+  EXPECT_EQ(3u, other.GetSamples().size());
+  EXPECT_TRUE(other.IsComplete());
+
+  std::string data = index.Serialize();
+  EXPECT_FALSE(loaded.Deserialize(data.substr(0, data.size() - 1)));
+  EXPECT_TRUE(loaded.GetSamples().empty());
+  data[0] = 'X';
+  EXPECT_FALSE(loaded.Deserialize(data));
+}
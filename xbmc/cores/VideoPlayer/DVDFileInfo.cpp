@@ -21,10 +21,13 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/MemUtils.h"
+#include "utils/ParallelFor.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "video/StreamDetailsCache.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoTrickplay.h"
 #ifdef HAVE_LIBBLURAY
 #include "DVDInputStreams/DVDInputStreamBluray.h"
 #endif
@@ -44,6 +47,7 @@
 #include "Util.h"
 #include "utils/LangCodeExpander.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 
@@ -253,6 +257,169 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
   return result;
 }
 
+std::unique_ptr<CTexture> CDVDFileInfo::ExtractTrickplayToTexture(
+    const CFileItem& fileItem, const KODI::VIDEO::TRICKPLAY::Layout& layout)
+{
+  using namespace KODI::VIDEO;
+
+  if (layout.tiles == 0 || !CanExtract(fileItem))
+    return {};
+
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+  auto start = std::chrono::steady_clock::now();
+
+  CFileItem item(fileItem);
+  item.SetMimeTypeForInternetFile();
+  auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
+  if (!pInputStream || !pInputStream->Open())
+  {
+    CLog::Log(LOGERROR, "InputStream: Error opening, {}", redactPath);
+    return {};
+  }
+
+  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true)};
+  if (!demuxer)
+  {
+    CLog::LogF(LOGERROR, "Error creating demuxer");
+    return {};
+  }
+
+  int nVideoStream = -1;
+  int64_t demuxerId = -1;
+  for (CDemuxStream* pStream : demuxer->GetStreams())
+  {
+    if (pStream)
+    {
+      // ignore if it's a picture attachment (e.g. jpeg artwork)
+      if (pStream->type == STREAM_VIDEO && !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC))
+      {
+        nVideoStream = pStream->uniqueId;
+        demuxerId = pStream->demuxerId;
+      }
+      else
+        demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
+    }
+  }
+
+  if (nVideoStream == -1)
+    return {};
+
+  const int interval = layout.interval;
+  const unsigned int tiles = layout.tiles;
+  const unsigned int columns = TRICKPLAY::COLUMNS;
+  const unsigned int tileWidth = TRICKPLAY::TILE_WIDTH;
+
+  std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts{AV_PIX_FMT_YUV420P};
+  pProcessInfo->SetPixFormats(pixFmts);
+
+  CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
+  hint.codecOptions = CODEC_FORCE_SOFTWARE;
+
+  std::unique_ptr<CDVDVideoCodec> pVideoCodec =
+      CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
+  if (!pVideoCodec)
+    return {};
+
+  // only key frames are needed, they are all a seek can land on anyway
+  pVideoCodec->SetCodecControl(DVD_CODEC_CTRL_KEYFRAMES);
+
+  std::unique_ptr<CTexture> result{};
+  unsigned int tileHeight = 0;
+  unsigned int extracted = 0;
+  struct SwsContext* context = nullptr;
+
+  for (unsigned int tile = 0; tile < tiles; tile++)
+  {
+    const double seekTo = static_cast<double>(tile) * interval * 1000;
+    if (!demuxer->SeekTime(seekTo, true))
+      continue;
+
+    pVideoCodec->Reset();
+
+    CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
+    VideoPicture picture = {};
+
+    // num streams * 160 frames, should get a valid frame, if not skip the tile.
+    int abort_index = demuxer->GetNrOfStreams() * 160;
+    do
+    {
+      DemuxPacket* pPacket = demuxer->Read();
+      if (!pPacket)
+        break;
+
+      if (pPacket->iStreamId != nVideoStream || pPacket->isELPackage)
+      {
+        CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+        continue;
+      }
+
+      pVideoCodec->AddData(*pPacket);
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+
+      iDecoderState = CDVDVideoCodec::VC_NONE;
+      while (iDecoderState == CDVDVideoCodec::VC_NONE)
+        iDecoderState = pVideoCodec->GetPicture(&picture);
+
+      if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
+        break;
+
+    } while (abort_index--);
+
+    if (iDecoderState != CDVDVideoCodec::VC_PICTURE || (picture.iFlags & DVP_FLAG_DROPPED))
+    {
+      CLog::LogF(LOGDEBUG, "decode failed for tile {} in {}", tile, redactPath);
+      continue;
+    }
+
+    // the first picture decides the size of the tiles
+    if (!result)
+    {
+      double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
+      if (hint.forced_aspect && hint.aspect != 0)
+        aspect = hint.aspect;
+      tileHeight = std::max(2u, static_cast<unsigned int>(tileWidth / aspect) & ~1u);
+
+      const unsigned int rows = (tiles + columns - 1) / columns;
+      result = CTexture::CreateTexture(columns * tileWidth, rows * tileHeight);
+      result->SetAlpha(false);
+      std::fill_n(result->GetPixels(), result->GetPitch() * result->GetRows(), 0);
+    }
+
+    context = sws_getCachedContext(context, picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P,
+                                   tileWidth, tileHeight, AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR,
+                                   nullptr, nullptr, nullptr);
+    if (!context)
+      break;
+
+    uint8_t* planes[YuvImage::MAX_PLANES];
+    int stride[YuvImage::MAX_PLANES];
+    picture.videoBuffer->GetPlanes(planes);
+    picture.videoBuffer->GetStrides(stride);
+    uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
+    int srcStride[] = {stride[0], stride[1], stride[2], 0};
+
+    const unsigned int x = (tile % columns) * tileWidth;
+    const unsigned int y = (tile / columns) * tileHeight;
+    uint8_t* dst[] = {result->GetPixels() + y * result->GetPitch() + x * 4, 0, 0, 0};
+    int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
+    sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
+    extracted++;
+  }
+
+  sws_freeContext(context);
+
+  auto end = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  CLog::LogF(LOGDEBUG, "measured {} ms to extract {} of {} trickplay tiles from file <{}>",
+             duration.count(), extracted, tiles, redactPath);
+
+  if (extracted == 0)
+    return {};
+
+  return result;
+}
+
 bool CDVDFileInfo::CanExtract(const CFileItem& fileItem)
 {
   if (fileItem.m_bIsFolder)
@@ -300,10 +467,49 @@ bool CDVDFileInfo::GetFileStreamDetails(CFileItem *pItem)
   if (strFileNameAndPath.empty())
     strFileNameAndPath = pItem->GetDynPath();
 
-  std::string playablePath = strFileNameAndPath;
+  CStreamDetails& details = pItem->GetVideoInfoTag()->m_streamDetails;
+  if (!ProbeStreamDetails(strFileNameAndPath, details))
+    return false;
+
+  const bool retVal = details.HasItems();
+  ProcessExternalSubtitles(pItem);
+  return retVal;
+}
+
+void CDVDFileInfo::PrefetchFileStreamDetails(const std::vector<std::string>& paths,
+                                             unsigned int threads,
+                                             const std::function<bool()>& cancelled)
+{
+  if (paths.empty() || threads == 0)
+    return;
+
+  // a slow share doesn't hold up the files behind it
+  UTILS::ParallelFor(paths.size(), threads, [&paths, &cancelled](size_t i) {
+    if (cancelled && cancelled())
+      return;
+
+    const CFileItem item(paths[i], false);
+    if (!CanExtract(item))
+      return;
+
+    CStreamDetails details;
+    ProbeStreamDetails(paths[i], details);
+  });
+}
+
+bool CDVDFileInfo::ProbeStreamDetails(const std::string& path, CStreamDetails& details)
+{
+  std::string playablePath = path;
   if (URIUtils::IsStack(playablePath))
     playablePath = XFILE::CStackDirectory::GetFirstStackedFile(playablePath);
 
+  // probing is the expensive part, look for an earlier result first
+  const VIDEO::CStreamDetailsCache cache;
+  VIDEO::CStreamDetailsCache::Key key;
+  const bool cacheable = VIDEO::CStreamDetailsCache::GetKey(path, key);
+  if (cacheable && cache.Load(key, details))
+    return true;
+
   CFileItem item(playablePath, false);
   item.SetMimeTypeForInternetFile();
   auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
@@ -320,18 +526,14 @@ bool CDVDFileInfo::GetFileStreamDetails(CFileItem *pItem)
     return false;
   }
 
-  CDVDDemux *pDemuxer = CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true);
-  if (pDemuxer)
-  {
-    bool retVal = DemuxerToStreamDetails(pInputStream, pDemuxer, pItem->GetVideoInfoTag()->m_streamDetails, strFileNameAndPath);
-    ProcessExternalSubtitles(pItem);
-    delete pDemuxer;
-    return retVal;
-  }
-  else
-  {
+  std::unique_ptr<CDVDDemux> pDemuxer(CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true));
+  if (!pDemuxer)
     return false;
-  }
+
+  if (DemuxerToStreamDetails(pInputStream, pDemuxer.get(), details, path) && cacheable)
+    cache.Save(key, details);
+
+  return true;
 }
 
 bool CDVDFileInfo::DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
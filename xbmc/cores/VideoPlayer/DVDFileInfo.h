@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -20,12 +21,29 @@ class CDVDInputStream;
 class CTexture;
 class CTextureDetails;
 
+namespace KODI::VIDEO::TRICKPLAY
+{
+struct Layout;
+}
+
 class CDVDFileInfo
 {
 public:
   static std::unique_ptr<CTexture> ExtractThumbToTexture(const CFileItem& fileItem,
                                                          int chapterNumber = 0);
 
+  /*!
+   * @brief Extract thumbnails at fixed intervals into a single tiled image.
+   *
+   * The file is opened once and only key frames are decoded, each tile shows the
+   * key frame at or before the start of its interval.
+   * @param fileItem the video file
+   * @param layout the layout of the tiled image, see KODI::VIDEO::TRICKPLAY::GetStoredLayout
+   * @return the tiled image, nullptr if no tile could be extracted
+   */
+  static std::unique_ptr<CTexture> ExtractTrickplayToTexture(
+      const CFileItem& fileItem, const KODI::VIDEO::TRICKPLAY::Layout& layout);
+
   /*!
    * @brief Can a thumbnail image and file stream details be extracted from this file item?
   */
@@ -34,9 +52,28 @@ public:
   // Probe the files streams and store the info in the VideoInfoTag
   static bool GetFileStreamDetails(CFileItem* pItem);
 
+  /*!
+   * @brief Probe the streams of several files at once.
+   *
+   * The results go to the stream details cache only, for the following calls of
+   * GetFileStreamDetails to find them there.
+   * @param paths the files
+   * @param threads most files probed at the same time
+   * @param cancelled checked before each file, stops probing when it returns true
+   */
+  static void PrefetchFileStreamDetails(const std::vector<std::string>& paths,
+                                        unsigned int threads,
+                                        const std::function<bool()>& cancelled);
+
   static bool GetFileDuration(const std::string& path, int& duration);
 
 private:
+  /*!
+   * @brief Probe the streams of a file, or take them from the stream details cache.
+   * @return false if the file couldn't be opened
+   */
+  static bool ProbeStreamDetails(const std::string& path, CStreamDetails& details);
+
   static bool DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
                                      CDVDDemux* pDemux,
                                      CStreamDetails& details,
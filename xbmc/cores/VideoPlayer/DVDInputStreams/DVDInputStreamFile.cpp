@@ -8,12 +8,21 @@
 
 #include "DVDInputStreamFile.h"
 
+#include "ServiceBroker.h"
+#include "URL.h"
 #include "filesystem/File.h"
 #include "filesystem/IFile.h"
+#include "filesystem/SpecialProtocol.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
 
+#if defined(TARGET_POSIX)
+#include "platform/posix/utils/MappedFile.h"
+#endif
+
 using namespace KODI;
 using namespace XFILE;
 
@@ -60,9 +69,22 @@ bool CDVDInputStreamFile::Open()
       content == "video/x-matroska-3d")
     flags |= READ_MULTI_STREAM;
 
+#if defined(TARGET_POSIX)
+  if ((flags & READ_AUDIO_VIDEO) &&
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoMmapInput)
+    OpenMapped();
+
+  // the cache would fill in parallel to the mapped reads
+  if (m_mappedFile)
+    flags |= READ_NO_CACHE;
+#endif
+
   // open file in binary mode
   if (!m_pFile->Open(m_item.GetDynPath(), flags))
   {
+#if defined(TARGET_POSIX)
+    m_mappedFile.reset();
+#endif
     delete m_pFile;
     m_pFile = NULL;
     return false;
@@ -75,9 +97,30 @@ bool CDVDInputStreamFile::Open()
   return true;
 }
 
+#if defined(TARGET_POSIX)
+void CDVDInputStreamFile::OpenMapped()
+{
+  const CURL url(CSpecialProtocol::TranslatePath(m_item.GetDynPath()));
+  if (!url.GetProtocol().empty() && !url.IsProtocol("file"))
+    return;
+
+  auto mappedFile = std::make_unique<UTILS::POSIX::CMappedFile>();
+  if (!mappedFile->Open(url.GetFileName()))
+    return;
+
+  m_mappedFile = std::move(mappedFile);
+  CLog::Log(LOGDEBUG, "CDVDInputStreamFile::{} - reading {} through a memory mapping",
+            __FUNCTION__, CURL::GetRedacted(m_item.GetDynPath()));
+}
+#endif
+
 // close file and reset everything
 void CDVDInputStreamFile::Close()
 {
+#if defined(TARGET_POSIX)
+  m_mappedFile.reset();
+#endif
+
   if (m_pFile)
   {
     m_pFile->Close();
@@ -93,6 +136,29 @@ int CDVDInputStreamFile::Read(uint8_t* buf, int buf_size)
 {
   if(!m_pFile) return -1;
 
+#if defined(TARGET_POSIX)
+  if (m_mappedFile)
+  {
+    const int read = m_mappedFile->Read(buf, buf_size);
+    if (read >= 0)
+    {
+      if (read == 0)
+        m_eof = true;
+      else if (m_pFile->GetBitstreamStats())
+        m_pFile->GetBitstreamStats()->AddSampleBytes(read);
+      return read;
+    }
+
+    // the file was truncated or the disk failed, it may still be readable without the mapping
+    CLog::Log(LOGWARNING, "CDVDInputStreamFile::{} - mapped read of {} failed, reading it regularly",
+              __FUNCTION__, CURL::GetRedacted(m_item.GetDynPath()));
+    const int64_t position = m_mappedFile->GetPosition();
+    m_mappedFile.reset();
+    if (m_pFile->Seek(position, SEEK_SET) != position)
+      return -1;
+  }
+#endif
+
   ssize_t ret = m_pFile->Read(buf, buf_size);
 
   if (ret < 0)
@@ -112,6 +178,16 @@ int64_t CDVDInputStreamFile::Seek(int64_t offset, int whence)
   if(whence == SEEK_POSSIBLE)
     return m_pFile->IoControl(IOCTRL_SEEK_POSSIBLE, NULL);
 
+#if defined(TARGET_POSIX)
+  if (m_mappedFile)
+  {
+    const int64_t ret = m_mappedFile->Seek(offset, whence);
+    if (ret >= 0)
+      m_eof = false;
+    return ret;
+  }
+#endif
+
   int64_t ret = m_pFile->Seek(offset, whence);
 
   /* if we succeed, we are not eof anymore */
@@ -122,6 +198,11 @@ int64_t CDVDInputStreamFile::Seek(int64_t offset, int whence)
 
 int64_t CDVDInputStreamFile::GetLength()
 {
+#if defined(TARGET_POSIX)
+  if (m_mappedFile)
+    return m_mappedFile->GetLength();
+#endif
+
   if (m_pFile)
     return m_pFile->GetLength();
   return 0;
@@ -10,6 +10,15 @@
 
 #include "DVDInputStream.h"
 
+#include <memory>
+
+#if defined(TARGET_POSIX)
+namespace KODI::UTILS::POSIX
+{
+class CMappedFile;
+}
+#endif
+
 class CDVDInputStreamFile : public CDVDInputStream
 {
 public:
@@ -27,6 +36,12 @@ public:
   bool GetCacheStatus(XFILE::SCacheStatus *status) override;
 
 protected:
+#if defined(TARGET_POSIX)
+  void OpenMapped();
+
+  //! local files are read through a memory mapping, m_pFile stays open for the rest
+  std::unique_ptr<KODI::UTILS::POSIX::CMappedFile> m_mappedFile;
+#endif
   XFILE::CFile* m_pFile = nullptr;
   bool m_eof = false;
   unsigned int m_flags = 0;
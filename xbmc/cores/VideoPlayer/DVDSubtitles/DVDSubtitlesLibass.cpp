@@ -164,6 +164,7 @@ bool CDVDSubtitlesLibass::DecodeHeader(char* data, int size)
   m_track = ass_new_track(m_library);
 
   ass_process_codec_private(m_track, data, size);
+  m_trackVersion++;
   return true;
 }
 
@@ -179,6 +180,7 @@ bool CDVDSubtitlesLibass::DecodeDemuxPkt(const char* data, int size, double star
   //! @bug libass isn't const correct
   ass_process_chunk(m_track, const_cast<char*>(data), size, DVD_TIME_TO_MSEC(start),
                     DVD_TIME_TO_MSEC(duration));
+  m_trackVersion++;
   return true;
 }
 
@@ -198,6 +200,7 @@ bool CDVDSubtitlesLibass::CreateTrack()
     CLog::Log(LOGERROR, "{} - Failed to allocate ASS track.", __FUNCTION__);
     return false;
   }
+  m_trackVersion++;
 
   m_track->track_type = m_track->TRACK_TYPE_ASS;
   m_track->Timer = 100.;
@@ -247,6 +250,8 @@ bool CDVDSubtitlesLibass::CreateTrack(char* buf, size_t size)
   if (m_track == NULL)
     return false;
 
+  m_trackVersion++;
+
   return true;
 }
 
@@ -640,6 +645,7 @@ int CDVDSubtitlesLibass::AddEvent(const char* text,
       event->MarginR = opts->marginRight;
       event->MarginV = opts->marginVertical;
     }
+    m_trackVersion++;
     return eventId;
   }
   else
@@ -676,6 +682,7 @@ void CDVDSubtitlesLibass::AppendTextToEvent(int eventId, const char* text)
     free(assEvent->Text);
     assEvent->Text = strdup(appendedText);
     delete[] appendedText;
+    m_trackVersion++;
   }
 }
 
@@ -700,7 +707,10 @@ void CDVDSubtitlesLibass::ChangeEventStopTime(int eventId, double stopTime)
 
   ASS_Event* assEvent = (assEvents + eventId);
   if (assEvent)
+  {
     assEvent->Duration = (DVD_TIME_TO_MSEC(stopTime) - assEvent->Start);
+    m_trackVersion++;
+  }
 }
 
 void CDVDSubtitlesLibass::FlushEvents()
@@ -713,6 +723,7 @@ void CDVDSubtitlesLibass::FlushEvents()
   }
 
   ass_flush_events(m_track);
+  m_trackVersion++;
 }
 
 int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
@@ -741,5 +752,12 @@ int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
   {
     m_track->events[i] = m_track->events[i + n];
   }
+  m_trackVersion++;
   return m_track->n_events - 1;
 }
+
+unsigned int CDVDSubtitlesLibass::GetTrackVersion() const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  return m_trackVersion;
+}
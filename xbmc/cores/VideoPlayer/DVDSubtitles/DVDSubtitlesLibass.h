@@ -83,6 +83,13 @@ public:
   */
   int GetPlayResY();
 
+  /*!
+  * \brief Get the version of the ASS track, it changes whenever events
+  * are added, changed or removed
+  * \return The track version
+  */
+  unsigned int GetTrackVersion() const;
+
 protected:
   /*!
   * \brief Create a new empty ASS track
@@ -159,6 +166,7 @@ private:
   ASS_Renderer* m_renderer = nullptr;
   mutable CCriticalSection m_section;
   ASSSubType m_subtitleType{NATIVE};
+  unsigned int m_trackVersion{0};
 
   // current default style ID of the ASS track
   int m_currentDefaultStyleId{ASS_NO_ID};
@@ -15,6 +15,7 @@
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDDemuxers/KeyframeIndexJob.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #include "network/NetworkFileItemClassify.h"
@@ -78,6 +79,8 @@ using namespace std::chrono_literals;
 namespace
 {
 constexpr double VP_MESSAGE_QUEUE_TIME_SIZE = 8.0;
+//! remaining playback time (ms) at which the next playlist item is opened ahead
+constexpr double PRELOAD_NEXT_ITEM_TIME = 120000.0;
 }
 
 //------------------------------------------------------------------------------
@@ -743,10 +746,18 @@ bool CVideoPlayer::CloseFile(bool reopen)
   m_HasVideo = false;
   m_HasAudio = false;
 
+  // playback was stopped, the next item won't follow
+  m_preloader.Clear();
+
   CLog::Log(LOGINFO, "VideoPlayer: finished waiting");
   return true;
 }
 
+void CVideoPlayer::PreloadNextFile(const CFileItem& file)
+{
+  m_preloader.Preload(file);
+}
+
 bool CVideoPlayer::IsPlaying() const
 {
   return !m_bStop;
@@ -769,22 +780,30 @@ bool CVideoPlayer::OpenInputStream()
   if (m_pInputStream.use_count() > 1)
     throw std::runtime_error("m_pInputStream reference count is greater than 1");
   m_pInputStream.reset();
+  m_pPreloadedDemuxer.reset();
 
-  CLog::Log(LOGINFO, "Creating InputStream");
-
-  m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
-  if (m_pInputStream == nullptr)
+  if (m_preloader.Take(m_item, m_pInputStream, m_pPreloadedDemuxer))
   {
-    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - unable to create input stream for [{}]",
-              CURL::GetRedacted(m_item.GetPath()));
-    return false;
+    CLog::Log(LOGINFO, "Using InputStream opened ahead of playback");
   }
-
-  if (!m_pInputStream->Open())
+  else
   {
-    CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - error opening [{}]",
-              CURL::GetRedacted(m_item.GetPath()));
-    return false;
+    CLog::Log(LOGINFO, "Creating InputStream");
+
+    m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
+    if (m_pInputStream == nullptr)
+    {
+      CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - unable to create input stream for [{}]",
+                CURL::GetRedacted(m_item.GetPath()));
+      return false;
+    }
+
+    if (!m_pInputStream->Open())
+    {
+      CLog::Log(LOGERROR, "CVideoPlayer::OpenInputStream - error opening [{}]",
+                CURL::GetRedacted(m_item.GetPath()));
+      return false;
+    }
   }
 
   // find any available external subtitles for non dvd files
@@ -834,8 +853,11 @@ bool CVideoPlayer::OpenDemuxStream()
 
   CLog::Log(LOGINFO, "Creating Demuxer");
 
+  // the input stream was probed along with opening it ahead of playback
+  m_pDemuxer = std::move(m_pPreloadedDemuxer);
+
   int attempts = 10;
-  while (!m_bStop && attempts-- > 0)
+  while (!m_pDemuxer && !m_bStop && attempts-- > 0)
   {
     m_pDemuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_pInputStream));
     if(!m_pDemuxer && m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
@@ -871,6 +893,13 @@ bool CVideoPlayer::OpenDemuxStream()
 
   m_offset_pts = 0;
 
+  // index the parts of the file playback doesn't reach once the player is done with it, opt-in
+  // like indexing on library scans
+  const auto* ffmpegDemuxer = dynamic_cast<CDVDDemuxFFmpeg*>(m_pDemuxer.get());
+  if (ffmpegDemuxer && ffmpegDemuxer->NeedsKeyframeIndex() &&
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoKeyframeIndexOnScan)
+    CKeyframeIndexJob::Queue(m_item);
+
   return true;
 }
 
@@ -1324,6 +1353,7 @@ void CVideoPlayer::CheckBetterStream(CCurrentStream& current, CDemuxStream* stre
 void CVideoPlayer::Prepare()
 {
   CFFmpegLog::SetLogLevel(1);
+  m_preloadRequested = false;
   SetPlaySpeed(DVD_PLAYSPEED_NORMAL);
   m_processInfo->SetSpeed(1.0);
   m_processInfo->SetTempo(1.0);
@@ -1494,6 +1524,9 @@ void CVideoPlayer::Process()
     // check if in an edit (cut or commercial break) that should be automatically skipped
     CheckAutoSceneSkip();
 
+    // have the next item opened by the time this one ends
+    CheckPreloadNextItem();
+
     // handle messages send to this thread, like seek or demuxer reset requests
     HandleMessages();
 
@@ -2530,6 +2563,22 @@ bool CVideoPlayer::CheckSceneSkip(const CCurrentStream& current)
   return hasEdit && hasEdit.value()->action == EDL::Action::CUT;
 }
 
+void CVideoPlayer::CheckPreloadNextItem()
+{
+  if (m_preloadRequested || m_State.timeMax <= 0 ||
+      m_State.timeMax - m_State.time > PRELOAD_NEXT_ITEM_TIME)
+    return;
+
+  // live streams don't end on their own
+  if (!m_pInputStream || m_pInputStream->IsRealtime() ||
+      m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
+    return;
+
+  m_preloadRequested = true;
+  IPlayerCallback* cb = &m_callback;
+  m_outboundEvents->Submit([=]() { cb->OnPreloadNextItem(); });
+}
+
 void CVideoPlayer::CheckAutoSceneSkip()
 {
   if (!m_Edl.HasEdits())
@@ -2715,6 +2764,7 @@ void CVideoPlayer::OnExit()
   // destroy objects
   m_renderManager.Flush(false, false);
   m_pDemuxer.reset();
+  m_pPreloadedDemuxer.reset();
   m_pSubtitleDemuxer.reset();
   m_subtitleDemuxerMap.clear();
   m_pCCDemuxer.reset();
@@ -5279,6 +5329,15 @@ bool CVideoPlayer::RenderCaptureGetPixels(unsigned int captureId, unsigned int m
   return m_renderManager.RenderCaptureGetPixels(captureId, millis, buffer, size);
 }
 
+bool CVideoPlayer::GetRenderTelemetry(std::vector<RenderFrameTelemetry>& frames) const
+{
+  if (!HasVideo())
+    return false;
+
+  frames = m_renderManager.GetTelemetry();
+  return true;
+}
+
 void CVideoPlayer::VideoParamsChange()
 {
   m_messenger.Put(std::make_shared<CDVDMsg>(CDVDMsg::PLAYER_AVCHANGE));
@@ -14,6 +14,7 @@
 #include "FileItem.h"
 #include "IVideoPlayer.h"
 #include "VideoPlayerAudioID3.h"
+#include "VideoPlayerPreloader.h"
 #include "VideoPlayerRadioRDS.h"
 #include "VideoPlayerSubtitle.h"
 #include "VideoPlayerTeletext.h"
@@ -258,6 +259,7 @@ public:
   ~CVideoPlayer() override;
   bool OpenFile(const CFileItem& file, const CPlayerOptions &options) override;
   bool CloseFile(bool reopen = false) override;
+  void PreloadNextFile(const CFileItem& file) override;
   bool IsPlaying() const override;
   void Pause() override;
   bool HasVideo() const override;
@@ -356,6 +358,7 @@ public:
   void RenderCapture(unsigned int captureId, unsigned int width, unsigned int height, int flags) override;
   void RenderCaptureRelease(unsigned int captureId) override;
   bool RenderCaptureGetPixels(unsigned int captureId, unsigned int millis, uint8_t *buffer, unsigned int size) override;
+  bool GetRenderTelemetry(std::vector<RenderFrameTelemetry>& frames) const override;
 
   // IDispResource interface
   void OnLostDisplay() override;
@@ -450,6 +453,7 @@ protected:
   bool IsInMenuInternal() const;
   void SynchronizeDemuxer();
   void CheckAutoSceneSkip();
+  void CheckPreloadNextItem();
   bool CheckContinuity(CCurrentStream& current, DemuxPacket* pPacket);
   bool CheckSceneSkip(const CCurrentStream& current);
   bool CheckPlayerInit(CCurrentStream& current);
@@ -556,6 +560,10 @@ protected:
   std::unordered_map<int64_t, std::shared_ptr<CDVDDemux>> m_subtitleDemuxerMap;
   std::unique_ptr<CDVDDemuxCC> m_pCCDemuxer;
 
+  CVideoPlayerPreloader m_preloader;
+  std::unique_ptr<CDVDDemux> m_pPreloadedDemuxer; ///< comes with a preloaded input stream
+  bool m_preloadRequested = false;
+
   CRenderManager m_renderManager;
 
   struct SDVDInfo
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoPlayerPreloader.h"
+
+#include "DVDDemuxers/DVDDemux.h"
+#include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "threads/Event.h"
+#include "utils/JobManager.h"
+#include "utils/log.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+struct CVideoPlayerPreloader::State
+{
+  std::string path;
+  CEvent done{true};
+  std::atomic<bool> cancelled{false};
+
+  CCriticalSection lock;
+  std::shared_ptr<CDVDInputStream> input;
+  std::unique_ptr<CDVDDemux> demuxer;
+};
+
+CVideoPlayerPreloader::CVideoPlayerPreloader() = default;
+
+CVideoPlayerPreloader::~CVideoPlayerPreloader()
+{
+  Clear();
+}
+
+void CVideoPlayerPreloader::Preload(const CFileItem& item)
+{
+  {
+    std::unique_lock<CCriticalSection> lock(m_lock);
+    if (m_state && m_state->path == item.GetDynPath())
+      return;
+  }
+  Clear();
+
+  auto state = std::make_shared<State>();
+  state->path = item.GetDynPath();
+  {
+    std::unique_lock<CCriticalSection> lock(m_lock);
+    m_state = state;
+  }
+
+  CLog::Log(LOGDEBUG, "CVideoPlayerPreloader::{} - opening {} ahead of playback", __FUNCTION__,
+            CURL::GetRedacted(state->path));
+  CServiceBroker::GetJobManager()->Submit([state, item]() { Run(state, item); });
+}
+
+bool CVideoPlayerPreloader::Take(const CFileItem& item,
+                                 std::shared_ptr<CDVDInputStream>& input,
+                                 std::unique_ptr<CDVDDemux>& demuxer)
+{
+  std::shared_ptr<State> state;
+  {
+    std::unique_lock<CCriticalSection> lock(m_lock);
+    state = std::move(m_state);
+  }
+  if (!state)
+    return false;
+
+  // the playlist may have changed since the preload or the user picked another item
+  if (state->path != item.GetDynPath() || !state->done.Wait(WAIT_TIME))
+  {
+    Cancel(state);
+    return false;
+  }
+
+  std::unique_lock<CCriticalSection> lock(state->lock);
+  if (!state->demuxer)
+    return false;
+
+  input = std::move(state->input);
+  demuxer = std::move(state->demuxer);
+  return true;
+}
+
+void CVideoPlayerPreloader::Clear()
+{
+  std::shared_ptr<State> state;
+  {
+    std::unique_lock<CCriticalSection> lock(m_lock);
+    state = std::move(m_state);
+  }
+  if (state)
+    Cancel(state);
+}
+
+void CVideoPlayerPreloader::Run(const std::shared_ptr<State>& state, CFileItem item)
+{
+  item.SetMimeTypeForInternetFile();
+
+  std::shared_ptr<CDVDInputStream> input =
+      CDVDFactoryInputStream::CreateInputStream(nullptr, item, true);
+  if (input && input->IsStreamType(DVDSTREAM_TYPE_FILE))
+  {
+    {
+      // let Cancel abort the open
+      std::unique_lock<CCriticalSection> lock(state->lock);
+      if (!state->cancelled)
+        state->input = input;
+    }
+
+    if (!state->cancelled && input->Open())
+    {
+      std::unique_ptr<CDVDDemux> demuxer(CDVDFactoryDemuxer::CreateDemuxer(input));
+
+      std::unique_lock<CCriticalSection> lock(state->lock);
+      if (demuxer && !state->cancelled)
+        state->demuxer = std::move(demuxer);
+    }
+  }
+
+  {
+    std::unique_lock<CCriticalSection> lock(state->lock);
+    if (!state->demuxer)
+    {
+      state->input.reset();
+      CLog::Log(LOGDEBUG, "CVideoPlayerPreloader::{} - nothing preloaded for {}", __FUNCTION__,
+                CURL::GetRedacted(state->path));
+    }
+  }
+  state->done.Set();
+}
+
+void CVideoPlayerPreloader::Cancel(const std::shared_ptr<State>& state)
+{
+  std::unique_lock<CCriticalSection> lock(state->lock);
+  state->cancelled = true;
+  if (state->input)
+    state->input->Abort();
+  state->demuxer.reset();
+  state->input.reset();
+}
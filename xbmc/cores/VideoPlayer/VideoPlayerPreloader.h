@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <memory>
+
+class CDVDDemux;
+class CDVDInputStream;
+class CFileItem;
+
+/*!
+ \brief Opens the next item of a playlist while the current one still plays.
+
+ Input stream and demuxer of the next item are created on a job, so the probe of
+ the demuxer and the fill of the file cache happen before the player gets to the
+ item. The player takes both over instead of opening the item itself.
+
+ Only plain files are preloaded, input streams that need the player (menus, PVR,
+ add-on input streams) or play several files are opened by the player as usual.
+ */
+class CVideoPlayerPreloader
+{
+public:
+  //! how long Take waits for a preload still in progress
+  static constexpr std::chrono::seconds WAIT_TIME{5};
+
+  CVideoPlayerPreloader();
+  ~CVideoPlayerPreloader();
+
+  /*!
+   \brief Start opening an item in the background, drops an earlier preload
+   */
+  void Preload(const CFileItem& item);
+
+  /*!
+   \brief Take over the input stream and demuxer opened for an item
+   \param item the item about to be played
+   \param[out] input the opened input stream
+   \param[out] demuxer the demuxer probed from input
+   \return false if the item wasn't preloaded or the preload failed, nothing is
+           preloaded anymore afterwards in any case
+   */
+  bool Take(const CFileItem& item,
+            std::shared_ptr<CDVDInputStream>& input,
+            std::unique_ptr<CDVDDemux>& demuxer);
+
+  //! Drop the preload, closing what was opened
+  void Clear();
+
+private:
+  struct State;
+  static void Run(const std::shared_ptr<State>& state, CFileItem item);
+  static void Cancel(const std::shared_ptr<State>& state);
+
+  CCriticalSection m_lock;
+  std::shared_ptr<State> m_state;
+};
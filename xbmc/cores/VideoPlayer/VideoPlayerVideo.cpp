@@ -355,6 +355,7 @@ void CVideoPlayerVideo::Process()
   m_videoStats.Start();
   m_droppingStats.Reset();
   m_iDroppedFrames = 0;
+  m_decodeTime = 0.0f;
   m_rewindStalled = false;
   m_outputSate = OUTPUT_NORMAL;
 
@@ -626,7 +627,13 @@ void CVideoPlayerVideo::Process()
         codecControl |= DVD_CODEC_CTRL_ROTATE;
       m_pVideoCodec->SetCodecControl(codecControl);
 
-      if (m_pVideoCodec->AddData(*pPacket))
+      const auto decodeStart = std::chrono::steady_clock::now();
+      const bool added = m_pVideoCodec->AddData(*pPacket);
+      m_decodeTime += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() -
+                                                               decodeStart)
+                          .count();
+
+      if (added)
       {
         // buffer packets so we can recover should decoder flush for some reason
         if (m_pVideoCodec->GetConvergeCount() > 0)
@@ -665,7 +672,11 @@ void CVideoPlayerVideo::Process()
 
 bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
 {
+  const auto decodeStart = std::chrono::steady_clock::now();
   CDVDVideoCodec::VCReturn decoderState = m_pVideoCodec->GetPicture(&m_picture);
+  m_decodeTime +=
+      std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - decodeStart)
+          .count();
 
   if (decoderState == CDVDVideoCodec::VC_BUFFER)
   {
@@ -832,6 +843,8 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
     {
       m_iDroppedFrames++;
       m_ptsTracker.Flush();
+      m_renderManager.AddDroppedFrame(m_picture.pts, m_decodeTime, RenderDropReason::OUTPUT);
+      m_decodeTime = 0.0f;
     }
 
     if (m_syncState == IDVDStreamPlayer::SYNC_STARTING &&
@@ -1023,7 +1036,11 @@ CVideoPlayerVideo::EOutputState CVideoPlayerVideo::OutputPicture(const VideoPict
   if (!m_processInfo.Supports(deintMethod))
     deintMethod = m_processInfo.GetDeinterlacingMethodDefault();
 
-  if (!m_renderManager.AddVideoPicture(*pPicture, m_bAbortOutput, deintMethod, (m_syncState == ESyncState::SYNC_STARTING)))
+  const float decodeTime = m_decodeTime;
+  m_decodeTime = 0.0f;
+
+  if (!m_renderManager.AddVideoPicture(*pPicture, m_bAbortOutput, deintMethod,
+                                       (m_syncState == ESyncState::SYNC_STARTING), decodeTime))
   {
     m_droppingStats.AddOutputDropGain(pPicture->pts, 1);
     return OUTPUT_DROPPED;
@@ -1215,6 +1232,8 @@ int CVideoPlayerVideo::CalcDropRequirement(double pts)
       m_droppingStats.m_gain.push_back(gain);
       m_droppingStats.m_totalGain += gain.frames;
       result |= DROP_DROPPED;
+      for (int i = 0; i < iSkippedPicture; i++)
+        m_renderManager.AddDroppedFrame(iDecoderPts, 0.0f, RenderDropReason::DECODER);
       CLog::Log(LOGDEBUG, LOGVIDEO,
                 "CVideoPlayerVideo::CalcDropRequirement - dropped pictures, lateframes: {}, "
                 "Bufferlevel: {}, dropped: {}",
@@ -1228,6 +1247,8 @@ int CVideoPlayerVideo::CalcDropRequirement(double pts)
       m_droppingStats.m_gain.push_back(gain);
       m_droppingStats.m_totalGain += iDroppedFrames;
       result |= DROP_DROPPED;
+      for (int i = 0; i < iDroppedFrames; i++)
+        m_renderManager.AddDroppedFrame(iDecoderPts, 0.0f, RenderDropReason::DECODER);
       CLog::Log(LOGDEBUG, LOGVIDEO,
                 "CVideoPlayerVideo::CalcDropRequirement - dropped in decoder, lateframes: {}, "
                 "Bufferlevel: {}, dropped: {}",
@@ -116,6 +116,7 @@ protected:
   int m_iLateFrames;
   int m_iDroppedFrames;
   int m_iDroppedRequest;
+  float m_decodeTime{0.0f}; // ms spent in the decoder since the last picture was output
 
   double m_fFrameRate;       //framerate of the video currently playing
   double m_fStableFrameRate; //place to store calculated framerates
@@ -16,6 +16,8 @@ struct DEBUG_INFO_PLAYER
   std::string video;
   std::string player;
   std::string vsync;
+  std::string frames;
+  std::string histograms;
 };
 
 struct DEBUG_INFO_VIDEO
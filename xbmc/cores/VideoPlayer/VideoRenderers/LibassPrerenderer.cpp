@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LibassPrerenderer.h"
+
+#include "OverlayRendererUtil.h"
+#include "cores/VideoPlayer/DVDSubtitles/DVDSubtitlesLibass.h"
+
+#include <mutex>
+#include <utility>
+
+using namespace KODI::SUBTITLES::STYLE;
+using namespace OVERLAY;
+
+namespace
+{
+bool IsSameOpts(const renderOpts& a, const renderOpts& b)
+{
+  return a.frameWidth == b.frameWidth && a.frameHeight == b.frameHeight &&
+         a.videoWidth == b.videoWidth && a.videoHeight == b.videoHeight &&
+         a.sourceWidth == b.sourceWidth && a.sourceHeight == b.sourceHeight &&
+         a.m_par == b.m_par && a.marginsMode == b.marginsMode && a.position == b.position &&
+         a.horizontalAlignment == b.horizontalAlignment;
+}
+} // namespace
+
+CLibassPrerenderer::CLibassPrerenderer(std::shared_ptr<CDVDSubtitlesLibass> libass)
+  : CThread("LibassPrerender"), m_libass(std::move(libass))
+{
+  Create();
+}
+
+CLibassPrerenderer::~CLibassPrerenderer()
+{
+  m_bStop = true;
+  m_event.Set();
+  StopThread();
+}
+
+std::shared_ptr<const SQuads> CLibassPrerenderer::GetImages(double pts,
+                                                            const renderOpts& opts,
+                                                            bool updateStyle,
+                                                            const std::shared_ptr<style>& subStyle,
+                                                            int& changes)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+
+  // learn the frame rate from the displayed frames, paused playback repeats the pts
+  if (m_pts != DVD_NOPTS_VALUE && pts > m_pts && pts - m_pts < MAX_STEP)
+    m_step = pts - m_pts;
+  m_pts = pts;
+
+  CSubtitleFrameQueue::SFrame frame;
+  const bool reset = updateStyle || !m_style || !IsSameOpts(opts, m_opts);
+  if (reset || !m_frames.Get(pts, m_step, frame))
+  {
+    lock.unlock();
+    std::unique_lock<CCriticalSection> renderLock(m_renderSection);
+    lock.lock();
+
+    m_opts = opts;
+    m_style = subStyle;
+    m_trackVersion = m_libass->GetTrackVersion();
+
+    bool changed;
+    m_frames.Reset(pts, Render(pts, opts, updateStyle, subStyle, changed, true));
+    m_frames.Get(pts, m_step, frame);
+  }
+
+  changes = frame.id != m_lastId ? 1 : 0;
+  m_lastId = frame.id;
+
+  if (HasWork())
+    m_event.Set();
+
+  return frame.quads;
+}
+
+void CLibassPrerenderer::Process()
+{
+  while (!m_bStop)
+  {
+    {
+      std::unique_lock<CCriticalSection> renderLock(m_renderSection);
+      std::unique_lock<CCriticalSection> lock(m_section);
+
+      const unsigned int trackVersion = m_libass->GetTrackVersion();
+      if (trackVersion != m_trackVersion)
+      {
+        // events were added or removed, what was rendered ahead may be stale
+        m_frames.Truncate(m_pts);
+        m_trackVersion = trackVersion;
+      }
+
+      if (HasWork())
+      {
+        const double pts = m_frames.GetEnd() + m_step;
+        const renderOpts opts = m_opts;
+        const std::shared_ptr<style> subStyle = m_style;
+        lock.unlock();
+
+        bool changed;
+        std::shared_ptr<const SQuads> quads = Render(pts, opts, false, subStyle, changed, false);
+
+        lock.lock();
+        m_frames.Add(pts, changed, std::move(quads));
+        continue;
+      }
+    }
+
+    m_event.Wait();
+  }
+}
+
+bool CLibassPrerenderer::HasWork() const
+{
+  return m_pts != DVD_NOPTS_VALUE && !m_frames.IsEmpty() &&
+         m_frames.GetEnd() < m_pts + LOOKAHEAD && m_frames.GetSize() < MAX_FRAMES;
+}
+
+std::shared_ptr<const SQuads> CLibassPrerenderer::Render(double pts,
+                                                         const renderOpts& opts,
+                                                         bool updateStyle,
+                                                         const std::shared_ptr<style>& subStyle,
+                                                         bool& changed,
+                                                         bool convertUnchanged)
+{
+  int changes = 0;
+  ASS_Image* images = m_libass->RenderImage(pts, opts, updateStyle, subStyle, &changes);
+  changed = changes != 0;
+  if (!images || (!changed && !convertUnchanged))
+    return nullptr;
+
+  auto quads = std::make_shared<SQuads>();
+  if (!convert_quad(images, *quads, static_cast<int>(opts.frameWidth)))
+    return nullptr;
+
+  return quads;
+}
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "SubtitleFrameQueue.h"
+#include "cores/VideoPlayer/DVDSubtitles/SubtitlesStyle.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <memory>
+
+class CDVDSubtitlesLibass;
+
+namespace OVERLAY
+{
+
+struct SQuads;
+
+/*!
+ \brief Renders libass subtitles on a worker thread ahead of the displayed frame.
+
+ Complex typesetting (karaoke, signs) can take longer to render than a frame is
+ shown, so rendering it on the render thread drops frames. The worker renders
+ the upcoming frames in presentation order and packs the images into glyph
+ atlases, the render thread only uploads the atlas of the frame it shows. The
+ change detection of libass keeps a single atlas for all frames showing the same
+ images.
+
+ The render thread renders on its own only after a seek, a change of the render
+ options or when the worker falls behind.
+ */
+class CLibassPrerenderer : private CThread
+{
+public:
+  //! how far ahead of the displayed frame the worker renders
+  static constexpr double LOOKAHEAD = DVD_SEC_TO_TIME(0.5);
+  //! most frames held ahead, bounds the memory used by animated typesetting
+  static constexpr size_t MAX_FRAMES = 32;
+
+  explicit CLibassPrerenderer(std::shared_ptr<CDVDSubtitlesLibass> libass);
+  ~CLibassPrerenderer() override;
+
+  /*!
+   \brief Get the subtitle images shown at pts
+   \param pts the presentation time of the displayed frame
+   \param opts the render options, a change drops the frames rendered ahead
+   \param updateStyle true if the style has to be applied again
+   \param subStyle the subtitle style
+   \param[out] changes 0 if the images are the same as the last call returned
+   \return the images packed into an atlas, nullptr if nothing is shown
+   */
+  std::shared_ptr<const SQuads> GetImages(
+      double pts,
+      const KODI::SUBTITLES::STYLE::renderOpts& opts,
+      bool updateStyle,
+      const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
+      int& changes);
+
+  //! true if the subtitle stream that owned the libass handler is gone
+  bool IsOrphaned() const { return m_libass.use_count() == 1; }
+
+private:
+  static constexpr double DEFAULT_STEP = DVD_SEC_TO_TIME(1.0 / 24);
+  static constexpr double MAX_STEP = DVD_SEC_TO_TIME(0.1);
+
+  void Process() override;
+  bool HasWork() const;
+
+  /*!
+   \brief Render the images at pts, m_renderSection must be held
+   \param[out] changed false if libass reports the same images as the last render
+   \param convertUnchanged pack the images into an atlas even if they didn't change
+   */
+  std::shared_ptr<const SQuads> Render(
+      double pts,
+      const KODI::SUBTITLES::STYLE::renderOpts& opts,
+      bool updateStyle,
+      const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
+      bool& changed,
+      bool convertUnchanged);
+
+  std::shared_ptr<CDVDSubtitlesLibass> m_libass;
+
+  CCriticalSection m_renderSection; ///< serialises the use of the libass renderer, taken first
+  CCriticalSection m_section;
+  CEvent m_event;
+
+  CSubtitleFrameQueue m_frames;
+  KODI::SUBTITLES::STYLE::renderOpts m_opts{};
+  std::shared_ptr<struct KODI::SUBTITLES::STYLE::style> m_style;
+  double m_pts{DVD_NOPTS_VALUE}; ///< pts of the displayed frame
+  double m_step{DEFAULT_STEP}; ///< distance between frames
+  unsigned int m_trackVersion{0};
+  unsigned int m_lastId{0}; ///< frame returned by the last call
+};
+
+} // namespace OVERLAY
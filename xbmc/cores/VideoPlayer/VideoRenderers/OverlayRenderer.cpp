@@ -9,6 +9,7 @@
 
 #include "OverlayRenderer.h"
 
+#include "LibassPrerenderer.h"
 #include "OverlayRendererUtil.h"
 #include "ServiceBroker.h"
 #include "application/ApplicationComponents.h"
@@ -90,6 +91,7 @@ void CRenderer::Flush()
     Release(buffer);
 
   ReleaseCache();
+  m_prerenderers.clear();
   Reset();
 }
 
@@ -136,6 +138,15 @@ void CRenderer::ReleaseUnused()
     else
       ++it;
   }
+
+  // stop the workers of subtitle streams that were closed
+  for (auto it = m_prerenderers.begin(); it != m_prerenderers.end();)
+  {
+    if (it->second->IsOrphaned())
+      it = m_prerenderers.erase(it);
+    else
+      ++it;
+  }
 }
 
 void CRenderer::Render(int idx, float depth)
@@ -504,13 +515,18 @@ std::shared_ptr<COverlay> CRenderer::ConvertLibass(
       rOpts.horizontalAlignment = SUBTITLES::STYLE::HorizontalAlign::CENTER;
   }
 
+  // subtitles are rendered ahead of time on a worker, one per libass handler
+  std::unique_ptr<CLibassPrerenderer>& prerenderer = m_prerenderers[o.GetLibassHandler().get()];
+  if (!prerenderer)
+    prerenderer = std::make_unique<CLibassPrerenderer>(o.GetLibassHandler());
+
   // changes: Detect changes from previously rendered images, if > 0 they are changed
   int changes = 0;
-  ASS_Image* images =
-      o.GetLibassHandler()->RenderImage(pts, rOpts, updateStyle, overlayStyle, &changes);
+  std::shared_ptr<const SQuads> quads =
+      prerenderer->GetImages(pts, rOpts, updateStyle, overlayStyle, changes);
 
   // If no images not execute the renderer
-  if (!images)
+  if (!quads)
     return nullptr;
 
   if (o.m_textureid)
@@ -524,7 +540,7 @@ std::shared_ptr<COverlay> CRenderer::ConvertLibass(
     }
   }
 
-  std::shared_ptr<COverlay> overlay = COverlay::Create(images, rOpts.frameWidth, rOpts.frameHeight);
+  std::shared_ptr<COverlay> overlay = COverlay::Create(*quads, rOpts.frameWidth, rOpts.frameHeight);
 
   m_textureCache[m_textureid] = overlay;
   o.m_textureid = m_textureid;
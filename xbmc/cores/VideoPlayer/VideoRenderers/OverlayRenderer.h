@@ -21,17 +21,19 @@
 #include <memory>
 #include <vector>
 
-typedef struct ass_image ASS_Image;
-
 class CDVDOverlay;
 class CDVDOverlayLibass;
 class CDVDOverlayImage;
 class CDVDOverlaySpu;
 class CDVDOverlaySSA;
 class CDVDOverlayText;
+class CDVDSubtitlesLibass;
 
 namespace OVERLAY {
 
+  class CLibassPrerenderer;
+  struct SQuads;
+
   struct SRenderState
   {
     float x;
@@ -45,7 +47,7 @@ namespace OVERLAY {
   public:
     static std::shared_ptr<COverlay> Create(const CDVDOverlayImage& o, CRect& rSource);
     static std::shared_ptr<COverlay> Create(const CDVDOverlaySpu& o);
-    static std::shared_ptr<COverlay> Create(ASS_Image* images, float width, float height);
+    static std::shared_ptr<COverlay> Create(const SQuads& quads, float width, float height);
 
     COverlay();
     virtual ~COverlay();
@@ -182,6 +184,7 @@ namespace OVERLAY {
     CCriticalSection m_section;
     std::vector<SElement> m_buffers[NUM_BUFFERS];
     std::map<unsigned int, std::shared_ptr<COverlay>> m_textureCache;
+    std::map<const CDVDSubtitlesLibass*, std::unique_ptr<CLibassPrerenderer>> m_prerenderers;
     static unsigned int m_textureid;
     CRect m_rv; // Frame size
     CRect m_rs; // Source size
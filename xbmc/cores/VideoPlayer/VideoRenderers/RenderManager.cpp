@@ -20,12 +20,14 @@
 #include "guilib/GUIComponent.h"
 #include "guilib/StereoscopicsManager.h"
 #include "messaging/ApplicationMessenger.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
 #include "utils/AMLUtils.h"
 #include "utils/StringUtils.h"
+#include "utils/TimeUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
@@ -220,6 +222,9 @@ bool CRenderManager::Configure()
     m_pRenderer->SetBufferSize(m_QueueSize);
     m_pRenderer->Update();
 
+    // one buffer is always on screen, the depth may grow into all others
+    m_queueDepth.Reset(m_QueueSize - 1);
+
     m_playerPort->UpdateRenderInfo(info);
     m_playerPort->UpdateGuiRender(true);
     m_playerPort->UpdateVideoRender(!m_pRenderer->IsGuiLayer());
@@ -244,6 +249,7 @@ bool CRenderManager::Configure()
     m_renderDebug = false;
     m_clockSync.Reset();
     m_dvdClock.SetVsyncAdjust(0);
+    UpdateMissedVsyncs();
     m_overlays.Reset();
     m_overlays.SetStereoMode(m_stereomode);
 
@@ -355,7 +361,7 @@ void CRenderManager::FrameMove()
         ++it;
     }
 
-    m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
+    UpdateRenderBuffers();
     m_bRenderGUI = true;
   }
 
@@ -395,6 +401,7 @@ void CRenderManager::PreInit()
   m_QueueSkip   = 0;
   m_presentstep = PRESENT_IDLE;
   m_bRenderGUI = true;
+  m_telemetry.Reset();
 
   m_initEvent.Set();
 }
@@ -730,9 +737,13 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
   if (!gui && m_pRenderer->IsGuiLayer())
     return;
 
+  // the renderers use their own shaders, draw the GUI batched so far first
+  CServiceBroker::GetRenderSystem()->FlushGUIBatch();
+
   if (!gui || m_pRenderer->IsGuiLayer())
   {
     SPresent& m = m_Queue[m_presentsource];
+    const int64_t presentStart = CurrentHostCounter();
 
     if( m.presentmethod == PRESENT_METHOD_BOB )
       PresentFields(clear, flags, alpha);
@@ -740,6 +751,8 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
       PresentBlend(clear, flags, alpha);
     else
       PresentSingle(clear, flags, alpha);
+
+    m.telemetry.renderTime += HostCounterToMs(CurrentHostCounter() - presentStart);
   }
 
   if (gui)
@@ -778,6 +791,9 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
           info.vsync += StringUtils::Format("VSync: refresh:{:.3f} missed:{} speed:{:.3f}%",
                                             refreshrate, missedvblanks, clockspeed * 100);
         }
+        m_telemetry.GetDebugInfo(info.frames, info.histograms);
+        info.frames += StringUtils::Format(" queue:{}/{}", m_queueDepth.GetDepth(),
+                                           m_queueDepth.GetMaxDepth());
 
         m_debugRenderer.SetInfo(info);
       }
@@ -789,7 +805,7 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
     }
   }
 
-  const SPresent& m = m_Queue[m_presentsource];
+  SPresent& m = m_Queue[m_presentsource];
 
   {
     std::unique_lock<CCriticalSection> lock(m_presentlock);
@@ -804,6 +820,14 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
     else if (m_presentstep == PRESENT_FRAME2)
       m_presentstep = PRESENT_IDLE;
 
+    // the picture is done once its last field was presented
+    if (m_presentstep == PRESENT_IDLE && m.queued)
+    {
+      m.telemetry.missedVsyncs = UpdateMissedVsyncs();
+      m_telemetry.Add(m.telemetry);
+      m.queued = 0;
+    }
+
     if (m_presentstep == PRESENT_IDLE)
     {
       if (!m_queued.empty())
@@ -989,13 +1013,20 @@ void CRenderManager::SetSubtitleVerticalPosition(int value, bool save)
   m_overlays.SetSubtitleVerticalPosition(value, save);
 }
 
-bool CRenderManager::AddVideoPicture(const VideoPicture& picture, volatile std::atomic_bool& bStop, EINTERLACEMETHOD deintMethod, bool wait)
+bool CRenderManager::AddVideoPicture(const VideoPicture& picture,
+                                     volatile std::atomic_bool& bStop,
+                                     EINTERLACEMETHOD deintMethod,
+                                     bool wait,
+                                     float decodeTime)
 {
   std::unique_lock<CCriticalSection> lock(m_presentlock);
 
-  if (m_free.empty())
+  if (GetFreeBuffers() == 0)
     return false;
 
+  if (m_fps > 0.0f)
+    m_queueDepth.AddDecodeTime(decodeTime, 1000.0f / m_fps);
+
   int index = m_free.front();
 
   {
@@ -1051,9 +1082,13 @@ bool CRenderManager::AddVideoPicture(const VideoPicture& picture, volatile std::
   m.presentfield = displayField;
   m.presentmethod = presentmethod;
   m.pts = picture.pts;
+  m.queued = CurrentHostCounter();
+  m.telemetry = {};
+  m.telemetry.pts = picture.pts;
+  m.telemetry.decodeTime = decodeTime;
   m_queued.push_back(m_free.front());
   m_free.pop_front();
-  m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
+  UpdateRenderBuffers();
 
   // signal to any waiters to check state
   if (m_presentstep == PRESENT_IDLE)
@@ -1145,7 +1180,7 @@ int CRenderManager::WaitForBuffer(volatile std::atomic_bool& bStop,
   }
 
   XbmcThreads::EndTime<> endtime{timeout};
-  while(m_free.empty())
+  while (GetFreeBuffers() == 0)
   {
     m_presentevent.wait(lock, std::min(50ms, timeout));
     if (endtime.IsTimePast() || bStop)
@@ -1186,6 +1221,7 @@ void CRenderManager::PrepareNextRender()
       static_cast<double>(CServiceBroker::GetWinSystem()->GetFrameLatencyAdjustment()));
 
   double renderPts = frameOnScreen + m_displayLatency;
+  const double dueClock = renderPts;
 
   double nextFramePts = m_Queue[m_queued.front()].pts;
   if (m_dvdClock.GetClockSpeed() < 0)
@@ -1260,6 +1296,11 @@ void CRenderManager::PrepareNextRender()
 
       if (m_presentsourcePast >= 0)
       {
+        DequeueTelemetry(m_Queue[m_presentsourcePast], dueClock);
+        m_Queue[m_presentsourcePast].telemetry.dropReason = RenderDropReason::LATE;
+        m_telemetry.Add(m_Queue[m_presentsourcePast].telemetry);
+        m_Queue[m_presentsourcePast].queued = 0;
+
         m_discard.push_back(m_presentsourcePast);
         m_QueueSkip++;
         m_presentsourcePast = -1;
@@ -1275,10 +1316,11 @@ void CRenderManager::PrepareNextRender()
     m_discard.push_back(m_presentsource);
     m_presentsource = idx;
     m_queued.pop_front();
+    DequeueTelemetry(m_Queue[idx], dueClock);
     m_presentpts = m_Queue[idx].pts - m_displayLatency;
     m_presentevent.notifyAll();
 
-    m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
+    UpdateRenderBuffers();
   }
   else if (!combined && renderPts > (nextFramePts - frametime))
   {
@@ -1287,11 +1329,48 @@ void CRenderManager::PrepareNextRender()
     m_presentsourcePast = m_presentsource;
     m_presentsource = m_queued.front();
     m_queued.pop_front();
+    DequeueTelemetry(m_Queue[m_presentsource], dueClock);
     m_presentpts = m_Queue[m_presentsource].pts - m_displayLatency - frametime / 2;
     m_presentevent.notifyAll();
   }
 }
 
+void CRenderManager::DequeueTelemetry(SPresent& present, double renderPts)
+{
+  present.telemetry.queueTime = HostCounterToMs(CurrentHostCounter() - present.queued);
+  present.telemetry.lateness =
+      static_cast<float>((renderPts - present.pts) * 1000.0 / DVD_TIME_BASE);
+  present.telemetry.clockSync =
+      m_clockSync.m_enabled ? static_cast<float>(m_clockSync.m_syncOffset * 1000.0 / DVD_TIME_BASE)
+                            : 0.0f;
+}
+
+unsigned int CRenderManager::UpdateMissedVsyncs()
+{
+  double refreshrate, clockspeed;
+  int missedvblanks;
+  if (!m_dvdClock.GetClockInfo(missedvblanks, clockspeed, refreshrate))
+    return 0;
+
+  const int missed = std::max(missedvblanks - m_missedVsyncs, 0);
+  m_missedVsyncs = missedvblanks;
+  return missed;
+}
+
+float CRenderManager::HostCounterToMs(int64_t counter)
+{
+  return static_cast<float>(counter * 1000.0 / CurrentHostFrequency());
+}
+
+void CRenderManager::AddDroppedFrame(double pts, float decodeTime, RenderDropReason reason)
+{
+  RenderFrameTelemetry frame;
+  frame.pts = pts;
+  frame.decodeTime = decodeTime;
+  frame.dropReason = reason;
+  m_telemetry.Add(frame);
+}
+
 void CRenderManager::DiscardBuffer()
 {
   std::unique_lock<CCriticalSection> lock2(m_presentlock);
@@ -1309,6 +1388,17 @@ void CRenderManager::DiscardBuffer()
   m_presentevent.notifyAll();
 }
 
+int CRenderManager::GetFreeBuffers() const
+{
+  return m_queueDepth.GetFree(static_cast<int>(m_queued.size()), static_cast<int>(m_free.size()));
+}
+
+void CRenderManager::UpdateRenderBuffers()
+{
+  // the player sees the buffers the queue depth lets it use, not all the renderer has
+  m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), GetFreeBuffers());
+}
+
 bool CRenderManager::BufferEmpty()
 {
   return bool(m_BufferLevel < 0);
@@ -10,6 +10,8 @@
 
 #include "DVDClock.h"
 #include "DebugRenderer.h"
+#include "RenderQueueDepth.h"
+#include "RenderTelemetry.h"
 #include "cores/VideoPlayer/VideoRenderers/BaseRenderer.h"
 #include "cores/VideoPlayer/VideoRenderers/OverlayRenderer.h"
 #include "cores/VideoSettings.h"
@@ -97,7 +99,14 @@ public:
   int GetSkippedFrames()  { return m_QueueSkip; }
 
   bool Configure(const VideoPicture& picture, float fps, unsigned int orientation, StreamHdrType hdrType, int buffers = 0);
-  bool AddVideoPicture(const VideoPicture& picture, volatile std::atomic_bool& bStop, EINTERLACEMETHOD deintMethod, bool wait);
+  /*!
+   * \param decodeTime milliseconds the decoder spent on the picture, for the telemetry
+   */
+  bool AddVideoPicture(const VideoPicture& picture,
+                       volatile std::atomic_bool& bStop,
+                       EINTERLACEMETHOD deintMethod,
+                       bool wait,
+                       float decodeTime);
   void AddOverlay(std::shared_ptr<CDVDOverlay> o, double pts);
   void ShowVideo(bool enable);
 
@@ -117,6 +126,16 @@ public:
    */
   bool GetStats(int &lateframes, double &pts, int &queued, int &discard);
 
+  /**
+   * Can be called by player to record a picture it dropped before queueing it
+   */
+  void AddDroppedFrame(double pts, float decodeTime, RenderDropReason reason);
+
+  /**
+   * Per picture timings of the most recent pictures, oldest first
+   */
+  std::vector<RenderFrameTelemetry> GetTelemetry() const { return m_telemetry.GetFrames(); }
+
   /**
    * Video player call this on flush in oder to discard any queued frames
    */
@@ -134,6 +153,8 @@ protected:
   void PresentBlend(bool clear, DWORD flags, DWORD alpha);
 
   void PrepareNextRender();
+  int GetFreeBuffers() const;
+  void UpdateRenderBuffers();
   bool IsPresenting();
   bool IsGuiLayer();
 
@@ -193,14 +214,27 @@ protected:
 
   int m_QueueSize = 2;
   int m_QueueSkip = 0;
+  CRenderQueueDepth m_queueDepth; ///< how many of the m_QueueSize buffers may be queued
 
   struct SPresent
   {
     double         pts;
     EFIELDSYNC     presentfield;
     EPRESENTMETHOD presentmethod;
+    int64_t        queued; ///< host counter when the picture was queued
+    RenderFrameTelemetry telemetry;
   } m_Queue[NUM_BUFFERS]{};
 
+  /*!
+   * \brief Fill in the queue time, lateness and clock correction of a picture leaving the queue
+   */
+  void DequeueTelemetry(SPresent& present, double renderPts);
+  /*!
+   * \brief Get the number of vblanks the clock missed since the last call
+   */
+  unsigned int UpdateMissedVsyncs();
+  static float HostCounterToMs(int64_t counter);
+
   std::deque<int> m_free;
   std::deque<int> m_queued;
   std::deque<int> m_discard;
@@ -240,6 +274,9 @@ protected:
   };
   CClockSync m_clockSync;
 
+  CRenderTelemetry m_telemetry;
+  int m_missedVsyncs = 0; ///< missed vblanks reported by the clock at the last presented picture
+
   void RenderCapture(CRenderCapture* capture);
   void RemoveCaptures();
   CCriticalSection m_captCritSect;
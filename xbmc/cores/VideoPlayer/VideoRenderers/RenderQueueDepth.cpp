@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RenderQueueDepth.h"
+
+#include <algorithm>
+#include <cmath>
+
+void CRenderQueueDepth::Reset(int maxDepth)
+{
+  m_count = 0;
+  m_next = 0;
+  m_sum = 0.0;
+  m_sumSquares = 0.0;
+  m_steadyCount = 0;
+
+  // start low, a bursty stream asks for more within its first few pictures
+  m_maxDepth = std::max(maxDepth, 1);
+  m_depth = std::min(MIN_DEPTH + 1, m_maxDepth);
+}
+
+void CRenderQueueDepth::AddDecodeTime(float decodeTime, float frameTime)
+{
+  if (m_count == WINDOW)
+  {
+    const double old = m_times[m_next];
+    m_sum -= old;
+    m_sumSquares -= old * old;
+  }
+  else
+    m_count++;
+
+  m_times[m_next] = decodeTime;
+  m_sum += decodeTime;
+  m_sumSquares += static_cast<double>(decodeTime) * decodeTime;
+  m_next = (m_next + 1) % WINDOW;
+
+  if (m_count < MIN_SAMPLES || frameTime <= 0.0f)
+    return;
+
+  const int target = GetTargetDepth(frameTime);
+  if (target > m_depth)
+  {
+    m_depth = target;
+    m_steadyCount = 0;
+  }
+  // only a full window of steady decoding is reason to give buffers back
+  else if (m_count < WINDOW)
+    return;
+  else if (target < m_depth && ++m_steadyCount >= WINDOW)
+  {
+    m_depth--;
+    m_steadyCount = 0;
+  }
+  else if (target == m_depth)
+    m_steadyCount = 0;
+}
+
+int CRenderQueueDepth::GetTargetDepth(float frameTime) const
+{
+  const double mean = m_sum / m_count;
+  const double variance = std::max(m_sumSquares / m_count - mean * mean, 0.0);
+  const double worst = mean + 3.0 * std::sqrt(variance);
+
+  // every frame time the slowest pictures take longer than their time on screen
+  // drains a picture from the queue
+  const int extra = static_cast<int>(std::ceil(std::max(worst - frameTime, 0.0) / frameTime));
+
+  return std::clamp(MIN_DEPTH + extra, std::min(MIN_DEPTH, m_maxDepth), m_maxDepth);
+}
+
+int CRenderQueueDepth::GetFree(int queued, int free) const
+{
+  return std::clamp(m_depth - queued, 0, std::max(free, 0));
+}
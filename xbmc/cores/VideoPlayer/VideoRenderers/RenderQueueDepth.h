@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+
+/*!
+ \brief Picks how many pictures the render queue may hold from the decode times.
+
+ A stream that decodes in steady time needs only a few pictures queued ahead, a
+ stream with bursty decode times needs enough to bridge its slowest pictures.
+ The depth follows the mean plus three standard deviations of the recent decode
+ times. It starts low, grows up to the buffers negotiated with renderer and
+ decoder as soon as a burst is seen and shrinks by one picture per window of
+ steady decoding.
+ */
+class CRenderQueueDepth
+{
+public:
+  //! pictures queued ahead of the one on screen even for steady streams
+  static constexpr int MIN_DEPTH = 2;
+  //! number of decode times the statistics are taken over
+  static constexpr int WINDOW = 64;
+  //! decode times needed before the depth may grow
+  static constexpr int MIN_SAMPLES = 8;
+
+  /*!
+   \brief Start over with a new configuration
+   \param maxDepth most pictures the queue can hold, given by the buffers of renderer and decoder
+
+   The depth starts one picture above MIN_DEPTH, the rest of the buffers are only
+   used once the decode times ask for them.
+   */
+  void Reset(int maxDepth);
+
+  /*!
+   \brief Account the decode time of a picture
+   \param decodeTime milliseconds the decoder spent on the picture
+   \param frameTime milliseconds a picture is on screen
+   */
+  void AddDecodeTime(float decodeTime, float frameTime);
+
+  int GetDepth() const { return m_depth; }
+  int GetMaxDepth() const { return m_maxDepth; }
+
+  /*!
+   \brief Get how many more pictures may be queued
+   \param queued pictures in the queue
+   \param free buffers the renderer has free
+   */
+  int GetFree(int queued, int free) const;
+
+private:
+  int GetTargetDepth(float frameTime) const;
+
+  std::array<float, WINDOW> m_times{};
+  int m_count{0};
+  int m_next{0};
+  double m_sum{0.0};
+  double m_sumSquares{0.0};
+
+  int m_maxDepth{MIN_DEPTH};
+  int m_depth{MIN_DEPTH};
+  int m_steadyCount{0}; ///< decode times since the target was last above the depth
+};
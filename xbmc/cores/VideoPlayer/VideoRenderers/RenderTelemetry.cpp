@@ -0,0 +1,130 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RenderTelemetry.h"
+
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+std::string FormatHistogram(const std::vector<unsigned int>& counts)
+{
+  std::vector<std::string> parts;
+  parts.reserve(counts.size());
+  for (const unsigned int count : counts)
+    parts.emplace_back(std::to_string(count));
+
+  return StringUtils::Join(parts, "/");
+}
+} // namespace
+
+void CRenderTelemetry::Add(const RenderFrameTelemetry& frame)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (m_frames.empty())
+    m_frames.resize(MAX_FRAMES);
+
+  m_frames[m_nextFrame] = frame;
+  if (++m_nextFrame == m_frames.size())
+  {
+    m_nextFrame = 0;
+    m_wrapped = true;
+  }
+}
+
+void CRenderTelemetry::Reset()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_nextFrame = 0;
+  m_wrapped = false;
+}
+
+std::vector<RenderFrameTelemetry> CRenderTelemetry::GetFrames() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  std::vector<RenderFrameTelemetry> frames;
+  frames.reserve(m_wrapped ? m_frames.size() : m_nextFrame);
+  if (m_wrapped)
+    frames.insert(frames.end(), m_frames.begin() + m_nextFrame, m_frames.end());
+  frames.insert(frames.end(), m_frames.begin(), m_frames.begin() + m_nextFrame);
+
+  return frames;
+}
+
+std::vector<unsigned int> CRenderTelemetry::GetHistogram(const std::vector<float>& values)
+{
+  std::vector<unsigned int> counts(HISTOGRAM_BOUNDS.size() + 1, 0);
+  for (const float value : values)
+  {
+    const auto bucket =
+        std::upper_bound(HISTOGRAM_BOUNDS.begin(), HISTOGRAM_BOUNDS.end(), value);
+    counts[bucket - HISTOGRAM_BOUNDS.begin()]++;
+  }
+
+  return counts;
+}
+
+CRenderTelemetry::Histograms CRenderTelemetry::GetHistograms(
+    const std::vector<RenderFrameTelemetry>& frames)
+{
+  std::vector<float> decode, queue, render, lateness;
+  for (const auto& frame : frames)
+  {
+    decode.push_back(frame.decodeTime);
+
+    // pictures dropped before queueing were never presented
+    if (frame.dropReason == RenderDropReason::DECODER ||
+        frame.dropReason == RenderDropReason::OUTPUT)
+      continue;
+
+    queue.push_back(frame.queueTime);
+    if (frame.dropReason == RenderDropReason::NONE)
+    {
+      render.push_back(frame.renderTime);
+      lateness.push_back(frame.lateness);
+    }
+  }
+
+  return {GetHistogram(decode), GetHistogram(queue), GetHistogram(render),
+          GetHistogram(lateness)};
+}
+
+void CRenderTelemetry::GetDebugInfo(std::string& frames, std::string& histograms) const
+{
+  const std::vector<RenderFrameTelemetry> records = GetFrames();
+
+  unsigned int dropped[4] = {};
+  unsigned int missedVsyncs = 0;
+  for (const auto& record : records)
+  {
+    dropped[static_cast<int>(record.dropReason)]++;
+    missedVsyncs += record.missedVsyncs;
+  }
+
+  const float clockSync = records.empty() ? 0.0f : records.back().clockSync;
+  frames = StringUtils::Format(
+      "Frames:{} drop dec:{} out:{} late:{} vsync missed:{} sync:{:.1f}ms", records.size(),
+      dropped[static_cast<int>(RenderDropReason::DECODER)],
+      dropped[static_cast<int>(RenderDropReason::OUTPUT)],
+      dropped[static_cast<int>(RenderDropReason::LATE)], missedVsyncs, clockSync);
+
+  std::vector<std::string> bounds;
+  for (const float bound : HISTOGRAM_BOUNDS)
+    bounds.emplace_back(StringUtils::Format("{:g}", bound));
+  bounds.emplace_back("+");
+
+  const Histograms counts = GetHistograms(records);
+  histograms = StringUtils::Format("ms {} dec:{} queue:{} render:{} late:{}",
+                                   StringUtils::Join(bounds, "/"), FormatHistogram(counts.decode),
+                                   FormatHistogram(counts.queue), FormatHistogram(counts.render),
+                                   FormatHistogram(counts.lateness));
+}
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+enum class RenderDropReason
+{
+  NONE,
+  DECODER, ///< dropped by the decoder or before decoding to catch up with the clock
+  OUTPUT, ///< decoded but not queued, e.g. no render buffer was available
+  LATE, ///< queued but skipped by the render manager because a later picture was due
+};
+
+/*!
+ \brief Timings of a single video picture on its way to the screen.
+
+ All durations are in milliseconds.
+ */
+struct RenderFrameTelemetry
+{
+  double pts{0.0}; ///< presentation timestamp of the picture
+  float decodeTime{0.0f}; ///< time spent in the decoder since the previous picture
+  float queueTime{0.0f}; ///< time the picture waited in the render queue
+  float renderTime{0.0f}; ///< time spent presenting the picture
+  float lateness{0.0f}; ///< presentation time minus due time, negative when early
+  float clockSync{0.0f}; ///< vsync offset the clock was adjusted by
+  unsigned int missedVsyncs{0}; ///< vblanks missed while the picture was on screen
+  RenderDropReason dropReason{RenderDropReason::NONE};
+};
+
+/*!
+ \brief Ring buffer of the telemetry of the most recent video pictures.
+
+ The render manager adds a record for every picture it presents or skips, the
+ video player for every picture it drops before queueing it. The records are
+ exported via JSON-RPC and summarised as histograms by the debug overlay.
+ */
+class CRenderTelemetry
+{
+public:
+  //! number of pictures kept in the ring buffer
+  static constexpr size_t MAX_FRAMES = 1024;
+
+  //! upper bounds of the histogram buckets in milliseconds, a last bucket takes the rest
+  static constexpr std::array<float, 6> HISTOGRAM_BOUNDS = {2.0f,  4.0f,  8.0f,
+                                                            16.0f, 33.0f, 66.0f};
+
+  void Add(const RenderFrameTelemetry& frame);
+  void Reset();
+
+  /*!
+   \brief Get the recorded pictures, oldest first
+   */
+  std::vector<RenderFrameTelemetry> GetFrames() const;
+
+  /*!
+   \brief Sort values into the buckets given by HISTOGRAM_BOUNDS
+   \return HISTOGRAM_BOUNDS.size() + 1 counts, negative values count towards the first bucket
+   */
+  static std::vector<unsigned int> GetHistogram(const std::vector<float>& values);
+
+  struct Histograms
+  {
+    std::vector<unsigned int> decode;
+    std::vector<unsigned int> queue; ///< pictures that made it into the render queue
+    std::vector<unsigned int> render; ///< presented pictures only
+    std::vector<unsigned int> lateness; ///< presented pictures only
+  };
+
+  /*!
+   \brief Get the histograms of the timings of the given pictures
+   */
+  static Histograms GetHistograms(const std::vector<RenderFrameTelemetry>& frames);
+
+  /*!
+   \brief Summarise the recorded pictures for the debug overlay
+   \param frames receives the drop counts and clock corrections
+   \param histograms receives the histograms of the timings
+   */
+  void GetDebugInfo(std::string& frames, std::string& histograms) const;
+
+private:
+  mutable CCriticalSection m_critSection;
+  std::vector<RenderFrameTelemetry> m_frames;
+  size_t m_nextFrame{0};
+  bool m_wrapped{false};
+};
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SubtitleFrameQueue.h"
+
+#include <utility>
+
+using namespace OVERLAY;
+
+void CSubtitleFrameQueue::Reset(double pts, std::shared_ptr<const SQuads> quads)
+{
+  m_frames.clear();
+  m_frames.push_back({pts, m_nextId++, std::move(quads)});
+  m_end = pts;
+}
+
+void CSubtitleFrameQueue::Add(double pts, bool changed, std::shared_ptr<const SQuads> quads)
+{
+  if (m_frames.empty())
+  {
+    Reset(pts, std::move(quads));
+    return;
+  }
+
+  if (pts <= m_end)
+    return;
+
+  if (changed)
+    m_frames.push_back({pts, m_nextId++, std::move(quads)});
+  m_end = pts;
+}
+
+bool CSubtitleFrameQueue::Get(double pts, double step, SFrame& frame)
+{
+  if (m_frames.empty() || pts < m_frames.front().start || pts > m_end + step)
+    return false;
+
+  // frames replaced by a later one before pts won't be shown anymore
+  while (m_frames.size() > 1 && m_frames[1].start <= pts)
+    m_frames.pop_front();
+
+  frame = m_frames.front();
+  return true;
+}
+
+void CSubtitleFrameQueue::Truncate(double pts)
+{
+  if (m_frames.empty() || m_end <= pts)
+    return;
+
+  while (m_frames.size() > 1 && m_frames.back().start > pts)
+    m_frames.pop_back();
+
+  if (m_frames.front().start > pts)
+    m_frames.clear();
+  else
+    m_end = pts;
+}
+
+void CSubtitleFrameQueue::Clear()
+{
+  m_frames.clear();
+  m_end = 0.0;
+}
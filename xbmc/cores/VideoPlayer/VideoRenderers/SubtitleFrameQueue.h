@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+
+namespace OVERLAY
+{
+
+struct SQuads;
+
+/*!
+ \brief Timeline of subtitle images rendered ahead of the displayed frame.
+
+ Subtitles are rendered at sample points in presentation order. A sample that
+ renders the same images as the one before extends the current frame, so a
+ static line of text takes up a single frame however long it is shown, while
+ animated typesetting gets a frame per change.
+
+ The queue isn't thread safe, the owner serialises access.
+ */
+class CSubtitleFrameQueue
+{
+public:
+  struct SFrame
+  {
+    double start{0.0}; ///< pts of the first sample showing the images
+    unsigned int id{0}; ///< differs for every frame with different images
+    std::shared_ptr<const SQuads> quads; ///< nullptr if nothing is shown
+  };
+
+  /*!
+   \brief Drop all frames and start over with the images at pts
+   */
+  void Reset(double pts, std::shared_ptr<const SQuads> quads);
+
+  /*!
+   \brief Add the images of the next sample point
+   \param pts sample point, after the last one
+   \param changed false if the images are the same as at the last sample point
+   */
+  void Add(double pts, bool changed, std::shared_ptr<const SQuads> quads);
+
+  /*!
+   \brief Get the frame shown at pts, dropping the frames before it
+   \param pts the presentation time
+   \param step distance between sample points, the last sample is assumed to
+          stay valid for that long
+   \return false if pts isn't covered by the rendered samples
+   */
+  bool Get(double pts, double step, SFrame& frame);
+
+  /*!
+   \brief Drop the samples after pts, e.g. when the subtitle track changed
+   */
+  void Truncate(double pts);
+
+  void Clear();
+
+  bool IsEmpty() const { return m_frames.empty(); }
+  size_t GetSize() const { return m_frames.size(); }
+
+  //! pts of the last sample point, only valid if not empty
+  double GetEnd() const { return m_end; }
+
+private:
+  std::deque<SFrame> m_frames;
+  double m_end{0.0};
+  unsigned int m_nextId{1};
+};
+
+} // namespace OVERLAY
@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/VideoRenderers/RenderQueueDepth.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr float FRAME_TIME = 16.7f;
+} // namespace
+
+TEST(TestRenderQueueDepth, StartsLow)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(7);
+  EXPECT_EQ(CRenderQueueDepth::MIN_DEPTH + 1, depth.GetDepth());
+  EXPECT_EQ(7, depth.GetMaxDepth());
+
+  // not enough samples to give a buffer back yet
+  for (int i = 0; i < CRenderQueueDepth::WINDOW - 1; i++)
+    depth.AddDecodeTime(1.0f, FRAME_TIME);
+  EXPECT_EQ(CRenderQueueDepth::MIN_DEPTH + 1, depth.GetDepth());
+
+  depth.Reset(1);
+  EXPECT_EQ(1, depth.GetDepth());
+}
+
+TEST(TestRenderQueueDepth, ShrinksForSteadyDecoding)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(7);
+
+  for (int i = 0; i < CRenderQueueDepth::WINDOW * 10; i++)
+    depth.AddDecodeTime(5.0f, FRAME_TIME);
+  EXPECT_EQ(CRenderQueueDepth::MIN_DEPTH, depth.GetDepth());
+}
+
+TEST(TestRenderQueueDepth, GrowsEarlyForBurstyStart)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(7);
+
+  // the first pictures of the stream already take several frame times each
+  for (int i = 0; i < CRenderQueueDepth::MIN_SAMPLES; i++)
+    depth.AddDecodeTime(i % 2 ? 1.0f : 4 * FRAME_TIME, FRAME_TIME);
+  EXPECT_GT(depth.GetDepth(), CRenderQueueDepth::MIN_DEPTH + 1);
+  EXPECT_LE(depth.GetDepth(), 7);
+}
+
+TEST(TestRenderQueueDepth, GrowsForBurstyDecoding)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(7);
+
+  for (int i = 0; i < CRenderQueueDepth::WINDOW * 10; i++)
+    depth.AddDecodeTime(5.0f, FRAME_TIME);
+  ASSERT_EQ(CRenderQueueDepth::MIN_DEPTH, depth.GetDepth());
+
+  // every eighth picture takes three frame times
+  for (int i = 0; i < CRenderQueueDepth::WINDOW; i++)
+    depth.AddDecodeTime(i % 8 ? 5.0f : 3 * FRAME_TIME, FRAME_TIME);
+  EXPECT_GT(depth.GetDepth(), CRenderQueueDepth::MIN_DEPTH + 1);
+  EXPECT_LE(depth.GetDepth(), 7);
+}
+
+TEST(TestRenderQueueDepth, StaysWithinBuffers)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(1);
+
+  for (int i = 0; i < CRenderQueueDepth::WINDOW * 4; i++)
+    depth.AddDecodeTime(i % 2 ? 1.0f : 10 * FRAME_TIME, FRAME_TIME);
+  EXPECT_EQ(1, depth.GetDepth());
+}
+
+TEST(TestRenderQueueDepth, Free)
+{
+  CRenderQueueDepth depth;
+  depth.Reset(7);
+  const int limit = depth.GetDepth();
+
+  // the depth limits the free buffers reported to the player, not just the renderer
+  EXPECT_EQ(limit, depth.GetFree(0, 7));
+  EXPECT_EQ(1, depth.GetFree(limit - 1, 7));
+  EXPECT_EQ(0, depth.GetFree(limit, 7));
+  EXPECT_EQ(0, depth.GetFree(limit + 1, 7));
+  EXPECT_EQ(1, depth.GetFree(0, 1));
+  EXPECT_EQ(0, depth.GetFree(0, 0));
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/VideoRenderers/RenderTelemetry.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+RenderFrameTelemetry MakeFrame(double pts,
+                               float time,
+                               RenderDropReason dropReason = RenderDropReason::NONE)
+{
+  RenderFrameTelemetry frame;
+  frame.pts = pts;
+  frame.decodeTime = time;
+  frame.queueTime = time;
+  frame.renderTime = time;
+  frame.lateness = time;
+  frame.dropReason = dropReason;
+  return frame;
+}
+} // namespace
+
+TEST(TestRenderTelemetry, KeepsMostRecentFrames)
+{
+  CRenderTelemetry telemetry;
+  EXPECT_TRUE(telemetry.GetFrames().empty());
+
+  for (size_t i = 0; i < CRenderTelemetry::MAX_FRAMES + 10; i++)
+    telemetry.Add(MakeFrame(static_cast<double>(i), 1.0f));
+
+  const auto frames = telemetry.GetFrames();
+  ASSERT_EQ(CRenderTelemetry::MAX_FRAMES, frames.size());
+  EXPECT_EQ(10.0, frames.front().pts);
+  EXPECT_EQ(static_cast<double>(CRenderTelemetry::MAX_FRAMES + 9), frames.back().pts);
+
+  telemetry.Reset();
+  EXPECT_TRUE(telemetry.GetFrames().empty());
+}
+
+TEST(TestRenderTelemetry, SortsValuesIntoBuckets)
+{
+  const auto counts = CRenderTelemetry::GetHistogram({-5.0f, 0.5f, 2.0f, 15.9f, 16.0f, 100.0f});
+  ASSERT_EQ(CRenderTelemetry::HISTOGRAM_BOUNDS.size() + 1, counts.size());
+  EXPECT_EQ(2u, counts[0]);
+  EXPECT_EQ(1u, counts[1]);
+  EXPECT_EQ(1u, counts[3]);
+  EXPECT_EQ(1u, counts[4]);
+  EXPECT_EQ(1u, counts.back());
+}
+
+TEST(TestRenderTelemetry, HistogramsSkipDroppedFrames)
+{
+  const std::vector<RenderFrameTelemetry> frames = {
+      MakeFrame(0.0, 1.0f), MakeFrame(1.0, 1.0f, RenderDropReason::DECODER),
+      MakeFrame(2.0, 1.0f, RenderDropReason::OUTPUT), MakeFrame(3.0, 1.0f, RenderDropReason::LATE)};
+
+  const auto histograms = CRenderTelemetry::GetHistograms(frames);
+  EXPECT_EQ(4u, histograms.decode[0]);
+  EXPECT_EQ(2u, histograms.queue[0]);
+  EXPECT_EQ(1u, histograms.render[0]);
+  EXPECT_EQ(1u, histograms.lateness[0]);
+}
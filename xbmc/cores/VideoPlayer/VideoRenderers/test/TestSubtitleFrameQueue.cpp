@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/VideoRenderers/OverlayRendererUtil.h"
+#include "cores/VideoPlayer/VideoRenderers/SubtitleFrameQueue.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace OVERLAY;
+
+namespace
+{
+constexpr double STEP = 40000.0;
+
+std::shared_ptr<const SQuads> MakeQuads()
+{
+  return std::make_shared<SQuads>();
+}
+} // namespace
+
+TEST(TestSubtitleFrameQueue, UnchangedSamplesExtendFrame)
+{
+  CSubtitleFrameQueue queue;
+  const auto quads = MakeQuads();
+  queue.Reset(0.0, quads);
+  for (int i = 1; i <= 10; i++)
+    queue.Add(i * STEP, false, nullptr);
+
+  EXPECT_EQ(1u, queue.GetSize());
+  EXPECT_EQ(10 * STEP, queue.GetEnd());
+
+  CSubtitleFrameQueue::SFrame frame;
+  ASSERT_TRUE(queue.Get(5 * STEP + 100.0, STEP, frame));
+  EXPECT_EQ(quads, frame.quads);
+
+  // the last sample stays valid for a step
+  EXPECT_TRUE(queue.Get(11 * STEP, STEP, frame));
+  EXPECT_FALSE(queue.Get(11 * STEP + 1.0, STEP, frame));
+  EXPECT_FALSE(queue.Get(-1.0, STEP, frame));
+}
+
+TEST(TestSubtitleFrameQueue, ChangedSamplesAddFrames)
+{
+  CSubtitleFrameQueue queue;
+  const auto first = MakeQuads();
+  const auto second = MakeQuads();
+  queue.Reset(0.0, first);
+  queue.Add(STEP, false, nullptr);
+  queue.Add(2 * STEP, true, second);
+  queue.Add(3 * STEP, true, nullptr);
+  EXPECT_EQ(3u, queue.GetSize());
+
+  CSubtitleFrameQueue::SFrame frame;
+  ASSERT_TRUE(queue.Get(STEP, STEP, frame));
+  EXPECT_EQ(first, frame.quads);
+  const unsigned int firstId = frame.id;
+
+  // between the samples the earlier images are shown
+  ASSERT_TRUE(queue.Get(2 * STEP + 1.0, STEP, frame));
+  EXPECT_EQ(second, frame.quads);
+  EXPECT_NE(firstId, frame.id);
+  EXPECT_EQ(2u, queue.GetSize());
+
+  ASSERT_TRUE(queue.Get(3 * STEP, STEP, frame));
+  EXPECT_EQ(nullptr, frame.quads);
+  EXPECT_EQ(1u, queue.GetSize());
+
+  // frames before the shown one are gone
+  EXPECT_FALSE(queue.Get(STEP, STEP, frame));
+}
+
+TEST(TestSubtitleFrameQueue, IgnoresOldSamples)
+{
+  CSubtitleFrameQueue queue;
+  queue.Reset(2 * STEP, MakeQuads());
+  queue.Add(STEP, true, MakeQuads());
+  queue.Add(2 * STEP, true, MakeQuads());
+  EXPECT_EQ(1u, queue.GetSize());
+  EXPECT_EQ(2 * STEP, queue.GetEnd());
+}
+
+TEST(TestSubtitleFrameQueue, Truncate)
+{
+  CSubtitleFrameQueue queue;
+  const auto first = MakeQuads();
+  queue.Reset(0.0, first);
+  queue.Add(STEP, false, nullptr);
+  queue.Add(2 * STEP, true, MakeQuads());
+  queue.Add(3 * STEP, false, nullptr);
+
+  queue.Truncate(STEP + 1.0);
+  EXPECT_EQ(1u, queue.GetSize());
+  EXPECT_EQ(STEP + 1.0, queue.GetEnd());
+
+  CSubtitleFrameQueue::SFrame frame;
+  ASSERT_TRUE(queue.Get(STEP, STEP, frame));
+  EXPECT_EQ(first, frame.quads);
+
+  // rendering goes on from the truncated end
+  const auto replaced = MakeQuads();
+  queue.Add(2 * STEP, true, replaced);
+  ASSERT_TRUE(queue.Get(2 * STEP, STEP, frame));
+  EXPECT_EQ(replaced, frame.quads);
+
+  queue.Truncate(-1.0);
+  EXPECT_TRUE(queue.IsEmpty());
+}
@@ -122,7 +122,9 @@ bool IDirectory::ProcessRequirements()
   if (type == "keyboard")
   {
     std::string input;
-    if (CGUIKeyboardFactory::ShowAndGetInput(input, m_requirements["heading"], false, m_requirements["hidden"].asBoolean()))
+    // look up before taking a reference to a sibling, adding the key may move the members
+    const bool hidden = m_requirements["hidden"].asBoolean();
+    if (CGUIKeyboardFactory::ShowAndGetInput(input, m_requirements["heading"], false, hidden))
     {
       m_requirements["input"] = input;
       return true;
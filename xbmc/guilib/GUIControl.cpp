@@ -11,6 +11,7 @@
 #include "GUIAction.h"
 #include "GUIComponent.h"
 #include "GUIControlProfiler.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIMessage.h"
 #include "GUITexture.h"
@@ -120,6 +121,8 @@ void CGUIControl::DynamicResourceAlloc(bool bOnOff)
 // 3. reset the animation transform
 void CGUIControl::DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyregions)
 {
+  GUIFRAMEPROFILER_CONTROL_SCOPE("Control::Process", this);
+
   CRect dirtyRegion = m_renderRegion;
 
   bool changed = (m_controlDirtyState & DIRTY_STATE_CONTROL) != 0 || (m_bInvalidated && IsVisible());
@@ -186,6 +189,8 @@ void CGUIControl::DoRender()
 
   if (IsVisible() && !m_isCulled)
   {
+    GUIFRAMEPROFILER_CONTROL_SCOPE("Control::Render", this);
+
     bool hasStereo =
         m_stereo != 0.0f &&
         CServiceBroker::GetWinSystem()->GetGfxContext().GetStereoMode() !=
@@ -615,6 +620,8 @@ bool CGUIControl::OnMouseOver(const CPoint &point)
 
 void CGUIControl::UpdateVisibility(const CGUIListItem *item)
 {
+  GUIFRAMEPROFILER_CONTROL_SCOPE("Control::Conditions", this);
+
   if (m_visibleCondition)
   {
     bool bWasVisible = m_visibleFromSkinCondition;
@@ -9,6 +9,7 @@
 #include "GUIFontTTF.h"
 
 #include "GUIFontManager.h"
+#include "GUIFrameProfiler.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
@@ -21,6 +22,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <math.h>
 #include <memory>
 #include <queue>
@@ -378,6 +380,8 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     return;
   }
 
+  GUIFRAMEPROFILER_SCOPE("Font::DrawText");
+
   Begin();
   uint32_t rawAlignment = alignment;
   bool dirtyCache(false);
@@ -451,6 +455,8 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     ValidateAlignments(alignment);
 
     const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+    CacheGlyphs(text, glyphs);
+
     // save the origin, which is scaled separately
 #if not defined(HAS_DX)
     // the origin is now at [0,0], and not at "random" locations anymore. positioning is done in the vertex shader.
@@ -746,6 +752,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 float CGUIFontTTF::GetTextWidthInternal(const vecText& text)
 {
   const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+  CacheGlyphs(text, glyphs);
   return GetTextWidthInternal(text, glyphs);
 }
 
@@ -919,32 +926,11 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   if (!glyphIndex)
     glyphIndex = FT_Get_Char_Index(m_face, letter);
 
-  // quick access to the most frequently used glyphs
-  if (glyphIndex < MAX_GLYPH_IDX)
-  {
-    character_t ch = (style << 12) | glyphIndex; // 2^12 = 4096
-
-    if (ch < LOOKUPTABLE_SIZE && m_charquick[ch])
-      return m_charquick[ch];
-  }
-
-  // letters are stored based on style and glyph
-  character_t ch = (style << 16) | glyphIndex;
-
-  // perform binary search on sorted array by m_glyphAndStyle and
-  // if not found obtains position to insert the new m_char to keep sorted
   int low = 0;
-  int high = m_char.size() - 1;
-  while (low <= high)
-  {
-    int mid = (low + high) >> 1;
-    if (ch > m_char[mid].m_glyphAndStyle)
-      low = mid + 1;
-    else if (ch < m_char[mid].m_glyphAndStyle)
-      high = mid - 1;
-    else
-      return &m_char[mid];
-  }
+  Character* cached = FindCharacter(style, glyphIndex, low);
+  if (cached)
+    return cached;
+
   // if we get to here, then low is where we should insert the new character
 
   int startIndex = low;
@@ -1002,6 +988,81 @@ CGUIFontTTF::Character* CGUIFontTTF::GetCharacter(character_t chr, FT_UInt glyph
   return m_char.data() + low;
 }
 
+CGUIFontTTF::Character* CGUIFontTTF::FindCharacter(character_t style,
+                                                   FT_UInt glyphIndex,
+                                                   int& insertPos)
+{
+  // quick access to the most frequently used glyphs
+  if (glyphIndex < MAX_GLYPH_IDX)
+  {
+    character_t ch = (style << 12) | glyphIndex; // 2^12 = 4096
+
+    if (ch < LOOKUPTABLE_SIZE && m_charquick[ch])
+      return m_charquick[ch];
+  }
+
+  // letters are stored based on style and glyph
+  character_t ch = (style << 16) | glyphIndex;
+
+  // perform binary search on sorted array by m_glyphAndStyle and
+  // if not found obtains position to insert the new m_char to keep sorted
+  int low = 0;
+  int high = m_char.size() - 1;
+  while (low <= high)
+  {
+    int mid = (low + high) >> 1;
+    if (ch > m_char[mid].m_glyphAndStyle)
+      low = mid + 1;
+    else if (ch < m_char[mid].m_glyphAndStyle)
+      high = mid - 1;
+    else
+      return &m_char[mid];
+  }
+
+  insertPos = low;
+  return nullptr;
+}
+
+void CGUIFontTTF::CacheGlyphs(const vecText& text, const std::vector<Glyph>& glyphs)
+{
+  const auto isMissing = [this, &text](const Glyph& glyph)
+  {
+    const character_t chr = text[glyph.m_glyphInfo.cluster];
+    if ((chr & 0xffff) == L'\r')
+      return false;
+
+    const character_t style = (chr & 0x7000000) >> 24;
+    FT_UInt glyphIndex = glyph.m_glyphInfo.codepoint;
+    if (!glyphIndex)
+      glyphIndex = FT_Get_Char_Index(m_face, static_cast<wchar_t>(chr & 0xffff));
+
+    int insertPos;
+    return FindCharacter(style, glyphIndex, insertPos) == nullptr;
+  };
+
+  auto firstMissing = std::find_if(glyphs.begin(), glyphs.end(), isMissing);
+  if (firstMissing == glyphs.end())
+    return;
+
+  // GetCharacter() has to leave the Begin(), End() block to render to our texture,
+  // do that once for all missing glyphs of the text instead of once per glyph
+  const unsigned int nestedBeginCount = m_nestedBeginCount;
+  if (nestedBeginCount)
+  {
+    m_nestedBeginCount = 1;
+    End();
+  }
+
+  for (auto it = firstMissing; it != glyphs.end(); ++it)
+    GetCharacter(text[it->m_glyphInfo.cluster], it->m_glyphInfo.codepoint);
+
+  if (nestedBeginCount)
+  {
+    Begin();
+    m_nestedBeginCount = nestedBeginCount;
+  }
+}
+
 bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch)
 {
   FT_Glyph glyph = nullptr;
@@ -172,6 +172,11 @@ protected:
 
   // Stuff for pre-rendering for speed
   Character* GetCharacter(character_t letter, FT_UInt glyphIndex);
+  Character* FindCharacter(character_t style, FT_UInt glyphIndex, int& insertPos);
+  /*! \brief Render all glyphs of the text that aren't in our texture yet in one go.
+   Avoids flushing a Begin(), End() block for every single new glyph, e.g. when CJK text first appears.
+   */
+  void CacheGlyphs(const vecText& text, const std::vector<Glyph>& glyphs);
   bool CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character* ch);
   void RenderCharacter(CGraphicContext& context,
                        float posX,
@@ -0,0 +1,256 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "GUIControlFactory.h"
+#include "filesystem/File.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/TimeUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+std::atomic<bool> CGUIFrameProfiler::m_running{false};
+
+namespace
+{
+//! innermost open scope of the calling thread
+thread_local CGUIFrameProfiler::CScope* currentScope = nullptr;
+
+std::atomic<unsigned int> nextThreadIndex{0};
+
+unsigned int GetThreadIndex()
+{
+  thread_local const unsigned int index = ++nextThreadIndex;
+  return index;
+}
+} // namespace
+
+CGUIFrameProfiler& CGUIFrameProfiler::GetInstance()
+{
+  static CGUIFrameProfiler profiler;
+  return profiler;
+}
+
+void CGUIFrameProfiler::Start()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (IsRunning())
+    return;
+
+  m_events.assign(MAX_EVENTS, {});
+  m_nextEvent = 0;
+  m_eventsWrapped = false;
+  m_frameEnds.assign(MAX_FRAMES, 0);
+  m_nextFrame = 0;
+  m_framesWrapped = false;
+
+  m_running = true;
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: started");
+}
+
+void CGUIFrameProfiler::Stop()
+{
+  m_running = false;
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: stopped");
+}
+
+void CGUIFrameProfiler::EndFrame()
+{
+  if (!IsRunning())
+    return;
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (m_frameEnds.empty())
+    return;
+
+  m_frameEnds[m_nextFrame] = CurrentHostCounter();
+  if (++m_nextFrame == m_frameEnds.size())
+  {
+    m_nextFrame = 0;
+    m_framesWrapped = true;
+  }
+}
+
+void CGUIFrameProfiler::AddEvent(const Event& event)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (m_events.empty())
+    return;
+
+  m_events[m_nextEvent] = event;
+  if (++m_nextEvent == m_events.size())
+  {
+    m_nextEvent = 0;
+    m_eventsWrapped = true;
+  }
+}
+
+void CGUIFrameProfiler::CScope::Begin(const char* name, int controlId, int controlType)
+{
+  m_active = true;
+  m_name = name;
+  m_controlId = controlId;
+  m_controlType = controlType;
+  m_parent = currentScope;
+  currentScope = this;
+  m_start = CurrentHostCounter();
+}
+
+void CGUIFrameProfiler::CScope::End()
+{
+  const int64_t duration = CurrentHostCounter() - m_start;
+
+  currentScope = m_parent;
+  if (m_parent)
+    m_parent->m_childTime += duration;
+
+  GetInstance().AddEvent({m_name, m_start, duration, duration - m_childTime, m_controlId,
+                          m_controlType, GetThreadIndex()});
+}
+
+std::vector<float> CGUIFrameProfiler::GetFrameTimes() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  std::vector<int64_t> ends;
+  if (m_framesWrapped)
+    ends.insert(ends.end(), m_frameEnds.begin() + m_nextFrame, m_frameEnds.end());
+  ends.insert(ends.end(), m_frameEnds.begin(), m_frameEnds.begin() + m_nextFrame);
+  lock.unlock();
+
+  const double scale = 1000.0 / CurrentHostFrequency();
+  std::vector<float> times;
+  for (size_t i = 1; i < ends.size(); ++i)
+    times.emplace_back(static_cast<float>((ends[i] - ends[i - 1]) * scale));
+
+  return times;
+}
+
+std::vector<CGUIFrameProfiler::ControlCost> CGUIFrameProfiler::GetControlCosts(unsigned int frames,
+                                                                            size_t count) const
+{
+  std::map<std::pair<int, int>, int64_t> selfTimes;
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+
+    const size_t recordedFrames = m_framesWrapped ? m_frameEnds.size() : m_nextFrame;
+    if (frames == 0 || recordedFrames < 2)
+      return {};
+
+    frames = std::min<unsigned int>(frames, recordedFrames - 1);
+    const size_t first = (m_nextFrame + m_frameEnds.size() - frames - 1) % m_frameEnds.size();
+    const size_t last = (m_nextFrame + m_frameEnds.size() - 1) % m_frameEnds.size();
+    const int64_t begin = m_frameEnds[first];
+    const int64_t end = m_frameEnds[last];
+
+    for (const auto& event : m_events)
+    {
+      if (event.name && event.controlId >= 0 && event.start >= begin && event.start < end)
+        selfTimes[{event.controlId, event.controlType}] += event.selfTime;
+    }
+  }
+
+  const double scale = 1000.0 / CurrentHostFrequency() / frames;
+  std::vector<ControlCost> costs;
+  costs.reserve(selfTimes.size());
+  for (const auto& [control, selfTime] : selfTimes)
+    costs.push_back({control.first, control.second, selfTime * scale});
+
+  std::sort(costs.begin(), costs.end(),
+            [](const ControlCost& a, const ControlCost& b) { return a.selfTime > b.selfTime; });
+  if (costs.size() > count)
+    costs.resize(count);
+
+  return costs;
+}
+
+bool CGUIFrameProfiler::SaveTrace(const std::string& path) const
+{
+  std::vector<Event> events;
+  std::vector<int64_t> frameEnds;
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+    if (m_eventsWrapped)
+      events.insert(events.end(), m_events.begin() + m_nextEvent, m_events.end());
+    events.insert(events.end(), m_events.begin(), m_events.begin() + m_nextEvent);
+    if (m_framesWrapped)
+      frameEnds.insert(frameEnds.end(), m_frameEnds.begin() + m_nextFrame, m_frameEnds.end());
+    frameEnds.insert(frameEnds.end(), m_frameEnds.begin(), m_frameEnds.begin() + m_nextFrame);
+  }
+
+  if (events.empty())
+    return false;
+
+  // events are recorded when they end, so the oldest start isn't necessarily the first one
+  int64_t base = events.front().start;
+  for (const auto& event : events)
+    base = std::min(base, event.start);
+
+  const double toMicroseconds = 1000000.0 / CurrentHostFrequency();
+
+  CVariant traceEvents(CVariant::VariantTypeArray);
+  for (const auto& event : events)
+  {
+    CVariant traceEvent(CVariant::VariantTypeObject);
+    traceEvent["name"] = event.name;
+    traceEvent["cat"] = event.controlId >= 0 ? "control" : "gui";
+    traceEvent["ph"] = "X";
+    traceEvent["ts"] = (event.start - base) * toMicroseconds;
+    traceEvent["dur"] = event.duration * toMicroseconds;
+    traceEvent["pid"] = 1;
+    traceEvent["tid"] = event.thread;
+    traceEvent["args"]["self"] = event.selfTime * toMicroseconds;
+    if (event.controlId >= 0)
+    {
+      traceEvent["args"]["id"] = event.controlId;
+      traceEvent["args"]["type"] = CGUIControlFactory::TranslateControlType(
+          static_cast<CGUIControl::GUICONTROLTYPES>(event.controlType));
+    }
+    traceEvents.push_back(std::move(traceEvent));
+  }
+
+  for (const int64_t frameEnd : frameEnds)
+  {
+    if (frameEnd < base)
+      continue;
+
+    CVariant traceEvent(CVariant::VariantTypeObject);
+    traceEvent["name"] = "Frame";
+    traceEvent["ph"] = "i";
+    traceEvent["s"] = "g";
+    traceEvent["ts"] = (frameEnd - base) * toMicroseconds;
+    traceEvent["pid"] = 1;
+    traceEvent["tid"] = 1;
+    traceEvents.push_back(std::move(traceEvent));
+  }
+
+  CVariant trace(CVariant::VariantTypeObject);
+  trace["traceEvents"] = std::move(traceEvents);
+  trace["displayTimeUnit"] = "ms";
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(trace, json, true))
+    return false;
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(json.c_str(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "CGUIFrameProfiler: failed to write trace to {}", path);
+    return false;
+  }
+
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: wrote {} events to {}", events.size(), path);
+  return true;
+}
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+\file GUIFrameProfiler.h
+\brief Low overhead timing of the GUI render loop.
+*/
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ \brief Records scoped timings of the render loop into a ring buffer.
+
+ Timings are only taken while the profiler is running, otherwise a scope costs
+ a single relaxed atomic load. The recorded events can be exported in the Chrome
+ trace event format (chrome://tracing, Perfetto) and the frame times are shown
+ by the debug info overlay.
+
+ Every event keeps its self time, i.e. its duration without the time spent in
+ nested scopes, so controls can be ranked by their own cost.
+ */
+class CGUIFrameProfiler
+{
+public:
+  static CGUIFrameProfiler& GetInstance();
+  static bool IsRunning() { return m_running.load(std::memory_order_relaxed); }
+
+  //! number of events kept in the ring buffer
+  static constexpr size_t MAX_EVENTS = 1 << 18;
+  //! number of frame times kept for the overlay
+  static constexpr size_t MAX_FRAMES = 240;
+
+  void Start();
+  void Stop();
+
+  /*!
+   \brief Mark the end of a frame, called once per rendered frame
+   */
+  void EndFrame();
+
+  struct Event
+  {
+    const char* name;
+    int64_t start;
+    int64_t duration;
+    int64_t selfTime;
+    int controlId;
+    int controlType;
+    unsigned int thread;
+  };
+
+  /*!
+   \brief Scoped timing, records an event when it goes out of scope
+   */
+  class CScope
+  {
+  public:
+    /*!
+     \param name static name of the event, the pointer is stored as is
+     \param controlId id of the control the event belongs to, -1 for none
+     \param controlType CGUIControl::GUICONTROLTYPES of the control
+     */
+    explicit CScope(const char* name, int controlId = -1, int controlType = 0)
+    {
+      if (IsRunning())
+        Begin(name, controlId, controlType);
+    }
+    ~CScope()
+    {
+      if (m_active)
+        End();
+    }
+
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    void Begin(const char* name, int controlId, int controlType);
+    void End();
+
+    bool m_active = false;
+    const char* m_name = nullptr;
+    int m_controlId = -1;
+    int m_controlType = 0;
+    int64_t m_start = 0;
+    int64_t m_childTime = 0;
+    CScope* m_parent = nullptr;
+  };
+
+  /*!
+   \brief Get the durations of the last frames in milliseconds, oldest first
+   */
+  std::vector<float> GetFrameTimes() const;
+
+  struct ControlCost
+  {
+    int controlId;
+    int controlType;
+    double selfTime; ///< milliseconds per frame
+  };
+
+  /*!
+   \brief Get the controls with the highest self time, averaged over the last frames
+   \param frames number of frames to look at
+   \param count maximum number of controls to return
+   */
+  std::vector<ControlCost> GetControlCosts(unsigned int frames, size_t count) const;
+
+  /*!
+   \brief Write the recorded events in the Chrome trace event format
+   \param path file to write to
+   \return true on success
+   */
+  bool SaveTrace(const std::string& path) const;
+
+private:
+  CGUIFrameProfiler() = default;
+  CGUIFrameProfiler(const CGUIFrameProfiler&) = delete;
+  CGUIFrameProfiler& operator=(const CGUIFrameProfiler&) = delete;
+
+  void AddEvent(const Event& event);
+
+  static std::atomic<bool> m_running;
+
+  mutable CCriticalSection m_critSection;
+  std::vector<Event> m_events;
+  size_t m_nextEvent = 0;
+  bool m_eventsWrapped = false;
+
+  std::vector<int64_t> m_frameEnds; ///< host counter at the end of the last frames
+  size_t m_nextFrame = 0;
+  bool m_framesWrapped = false;
+};
+
+#define GUIFRAMEPROFILER_SCOPE(name) CGUIFrameProfiler::CScope guiFrameProfilerScope(name)
+#define GUIFRAMEPROFILER_CONTROL_SCOPE(name, control) \
+  CGUIFrameProfiler::CScope guiFrameProfilerScope(name, (control)->GetID(), \
+                                                  (control)->GetControlType())
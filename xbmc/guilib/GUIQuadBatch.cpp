@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIQuadBatch.h"
+
+#include <cassert>
+
+bool GUIQuadBatchState::operator==(const GUIQuadBatchState& right) const
+{
+  return shader == right.shader && texture == right.texture && diffuse == right.diffuse &&
+         color == right.color && depth == right.depth && blending == right.blending;
+}
+
+bool CGUIQuadBatch::CanAppend(const GUIQuadBatchState& state, size_t quads) const
+{
+  if (IsEmpty())
+    return quads <= MAX_QUADS;
+
+  return m_state == state && GetQuadCount() + quads <= MAX_QUADS;
+}
+
+void CGUIQuadBatch::Append(const GUIQuadBatchState& state, const Vertex* vertices, size_t count)
+{
+  assert(count % 4 == 0);
+  assert(CanAppend(state, count / 4));
+
+  if (IsEmpty())
+    m_state = state;
+
+  const size_t first = m_vertices.size();
+  m_vertices.insert(m_vertices.end(), vertices, vertices + count);
+
+  for (size_t i = first; i < m_vertices.size(); i += 4)
+  {
+    const uint16_t index = static_cast<uint16_t>(i);
+    m_indices.push_back(index + 0);
+    m_indices.push_back(index + 1);
+    m_indices.push_back(index + 2);
+    m_indices.push_back(index + 2);
+    m_indices.push_back(index + 3);
+    m_indices.push_back(index + 0);
+  }
+}
+
+void CGUIQuadBatch::Clear()
+{
+  // keep the capacity, batches are refilled every frame
+  m_vertices.clear();
+  m_indices.clear();
+}
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+\file GUIQuadBatch.h
+\brief Render API independent collection of GUI texture quads sharing the same draw state.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*!
+ \brief Draw state shared by all quads of a batch.
+
+ Two quads may only be drawn by the same draw call if their states compare equal.
+ The shader is the render system specific shader method, the textures are the
+ render system specific texture handles.
+ */
+struct GUIQuadBatchState
+{
+  int shader{0};
+  unsigned int texture{0};
+  unsigned int diffuse{0};
+  std::array<uint8_t, 4> color{};
+  float depth{0.0f};
+  bool blending{true};
+
+  bool operator==(const GUIQuadBatchState& right) const;
+  bool operator!=(const GUIQuadBatchState& right) const { return !(*this == right); }
+};
+
+/*!
+ \brief Collects consecutive GUI texture quads so they can be flushed in a single draw call.
+
+ Only quads that are submitted back to back with an identical state are merged,
+ so the draw order of the GUI is preserved. The owning render system is
+ responsible for flushing the batch before anything else is drawn.
+ */
+class CGUIQuadBatch
+{
+public:
+  struct Vertex
+  {
+    float x, y, z;
+    float u1, v1;
+    float u2, v2;
+  };
+
+  //! 16 bit indices are used, so a batch can't address more vertices than that
+  static constexpr size_t MAX_QUADS = 65536 / 4;
+
+  bool IsEmpty() const { return m_vertices.empty(); }
+  size_t GetQuadCount() const { return m_vertices.size() / 4; }
+
+  /*!
+   \brief Check whether quads with the given state can be added to the pending batch
+   \param state the draw state of the quads
+   \param quads the number of quads to add
+   \return true if the batch is empty or the quads can be merged with it
+   */
+  bool CanAppend(const GUIQuadBatchState& state, size_t quads) const;
+
+  /*!
+   \brief Add quads to the batch. Callers must check CanAppend() first.
+   \param state the draw state of the quads, adopted if the batch is empty
+   \param vertices four vertices per quad
+   \param count number of vertices
+   */
+  void Append(const GUIQuadBatchState& state, const Vertex* vertices, size_t count);
+
+  void Clear();
+
+  const GUIQuadBatchState& GetState() const { return m_state; }
+  const std::vector<Vertex>& GetVertices() const { return m_vertices; }
+  const std::vector<uint16_t>& GetIndices() const { return m_indices; }
+
+private:
+  GUIQuadBatchState m_state;
+  std::vector<Vertex> m_vertices;
+  std::vector<uint16_t> m_indices;
+};
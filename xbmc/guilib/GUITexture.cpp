@@ -300,6 +300,7 @@ void CGUITexture::Render(float left,
 
   int orientation = GetOrientation();
   OrientateTexture(texture, u3, v3, orientation);
+  texture += m_texCoordsOffset;
 
   if (m_diffuse.size())
   {
@@ -309,6 +310,7 @@ void CGUITexture::Render(float left,
     diffuse.y1 *= m_diffuseScaleV / v3; diffuse.y2 *= m_diffuseScaleV / v3;
     diffuse += m_diffuseOffset;
     OrientateTexture(diffuse, m_diffuseU, m_diffuseV, m_info.orientation);
+    diffuse += m_diffuseTexOffset;
   }
 
   float x[4], y[4], z[4];
@@ -417,6 +419,13 @@ bool CGUITexture::CalculateSize()
   m_texCoordsScaleU = 1.0f / m_texture.m_texWidth;
   m_texCoordsScaleV = 1.0f / m_texture.m_texHeight;
 
+  // frames packed into a texture atlas don't start at the origin
+  if (m_texture.m_texCoordsArePixels)
+    m_texCoordsOffset = CPoint(m_texture.m_texOffsetX, m_texture.m_texOffsetY);
+  else
+    m_texCoordsOffset = CPoint(m_texture.m_texOffsetX * m_texCoordsScaleU,
+                               m_texture.m_texOffsetY * m_texCoordsScaleV);
+
   if (m_width == 0)
     m_width = m_frameWidth;
   if (m_height == 0)
@@ -475,11 +484,15 @@ bool CGUITexture::CalculateSize()
     {
       m_diffuseU = float(m_diffuse.m_width);
       m_diffuseV = float(m_diffuse.m_height);
+      m_diffuseTexOffset = CPoint(m_diffuse.m_texOffsetX, m_diffuse.m_texOffsetY);
     }
     else
     {
       m_diffuseU = float(m_diffuse.m_width) / float(m_diffuse.m_texWidth);
       m_diffuseV = float(m_diffuse.m_height) / float(m_diffuse.m_texHeight);
+      m_diffuseTexOffset =
+          CPoint(float(m_diffuse.m_texOffsetX) / float(m_diffuse.m_texWidth),
+                 float(m_diffuse.m_texOffsetY) / float(m_diffuse.m_texHeight));
     }
 
     if (m_aspect.scaleDiffuse)
@@ -521,6 +534,8 @@ void CGUITexture::FreeResources(bool immediately /* = false */)
 
   m_texCoordsScaleU = 1.0f;
   m_texCoordsScaleV = 1.0f;
+  m_texCoordsOffset = CPoint(0, 0);
+  m_diffuseTexOffset = CPoint(0, 0);
 
   // call our implementation
   Free();
@@ -8,22 +8,14 @@
 
 #pragma once
 
+#include "GUIQuadBatch.h"
 #include "GUITexture.h"
 #include "utils/ColorUtils.h"
 
-#include <array>
 #include <vector>
 
 #include "system_gl.h"
 
-struct PackedVertex
-{
-  float x, y, z;
-  float u1, v1;
-  float u2, v2;
-};
-typedef std::vector<PackedVertex> PackedVertices;
-
 class CRenderSystemGLES;
 
 class CGUITextureGLES : public CGUITexture
@@ -53,10 +45,8 @@ protected:
 private:
   CGUITextureGLES(const CGUITextureGLES& texture) = default;
 
-  std::array<GLubyte, 4> m_col;
-
-  PackedVertices m_packedVertices;
-  std::vector<GLushort> m_idx;
+  GUIQuadBatchState m_batchState;
+  std::vector<CGUIQuadBatch::Vertex> m_packedVertices;
   CRenderSystemGLES *m_renderSystem;
 };
 
@@ -120,6 +120,24 @@ public:
   virtual void SyncGPU(){};
   virtual void BindToUnit(unsigned int unit) = 0;
 
+  /*!
+   * \brief Replaces a rectangle of a texture that has been uploaded to the GPU already.
+   \param x left edge of the rectangle.
+   \param y top edge of the rectangle.
+   \param width the width of the rectangle.
+   \param height the height of the rectangle.
+   \param pixels tightly packed rows of pixels in the format of the texture.
+   \return false if the texture isn't on the GPU or its parts can't be updated.
+   */
+  virtual bool UpdateRect(unsigned int x,
+                          unsigned int y,
+                          unsigned int width,
+                          unsigned int height,
+                          const unsigned char* pixels)
+  {
+    return false;
+  }
+
   /*! 
    * \brief Checks if the processing pipeline can handle the texture format/swizzle
    \param format the format of the texture.
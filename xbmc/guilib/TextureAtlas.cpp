@@ -0,0 +1,194 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureAtlas.h"
+
+#include "guilib/Texture.h"
+#include "guilib/TextureFormats.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+//! every texture is surrounded by a border of this many replicated pixels
+constexpr unsigned int GUTTER = 1;
+constexpr unsigned int BYTES_PER_PIXEL = 4;
+} // namespace
+
+CTextureAtlasPacker::CTextureAtlasPacker(unsigned int width, unsigned int height)
+  : m_width(width), m_height(height)
+{
+}
+
+std::optional<CTextureAtlasPacker::Position> CTextureAtlasPacker::Insert(unsigned int width,
+                                                                         unsigned int height)
+{
+  if (width == 0 || height == 0 || width > m_width || height > m_height)
+    return {};
+
+  // pick the shelf that wastes the least height
+  Shelf* best = nullptr;
+  for (auto& shelf : m_shelves)
+  {
+    if (shelf.height < height || shelf.used + width > m_width)
+      continue;
+    if (!best || shelf.height < best->height)
+      best = &shelf;
+  }
+
+  if (!best)
+  {
+    if (m_bottom + height > m_height)
+      return {};
+
+    m_shelves.push_back({m_bottom, height, 0});
+    m_bottom += height;
+    best = &m_shelves.back();
+  }
+
+  Position position{best->used, best->y};
+  best->used += width;
+  m_usedArea += static_cast<uint64_t>(width) * height;
+
+  return position;
+}
+
+bool CTextureAtlas::CanPack(unsigned int width, unsigned int height)
+{
+  return width > 0 && height > 0 && width <= MAX_TEXTURE_SIZE && height <= MAX_TEXTURE_SIZE;
+}
+
+std::optional<CTextureAtlas::Entry> CTextureAtlas::Find(const std::string& name) const
+{
+  auto it = m_entries.find(name);
+  if (it == m_entries.end())
+    return {};
+
+  return it->second;
+}
+
+std::optional<CTextureAtlas::Entry> CTextureAtlas::Add(const std::string& name,
+                                                       unsigned int width,
+                                                       unsigned int height,
+                                                       unsigned int pitch,
+                                                       const uint8_t* pixels,
+                                                       bool hasAlpha)
+{
+  if (!pixels || !CanPack(width, height))
+    return {};
+
+  const unsigned int slotWidth = width + 2 * GUTTER;
+  const unsigned int slotHeight = height + 2 * GUTTER;
+
+  Page* page = nullptr;
+  std::optional<CTextureAtlasPacker::Position> position;
+  for (auto& candidate : m_pages)
+  {
+    if (candidate->alpha != hasAlpha)
+      continue;
+
+    position = candidate->packer.Insert(slotWidth, slotHeight);
+    if (position)
+    {
+      page = candidate.get();
+      break;
+    }
+  }
+
+  if (!page)
+  {
+    if (m_pages.size() >= MAX_PAGES)
+      return {};
+
+    auto newPage = std::make_unique<Page>();
+    newPage->texture = CTexture::CreateTexture();
+    if (!newPage->texture)
+      return {};
+
+    // the pixels stay with the texture until it gets uploaded on first use
+    newPage->texture->Allocate(PAGE_SIZE, PAGE_SIZE, XB_FMT_A8R8G8B8);
+    if (!newPage->texture->GetPixels() ||
+        newPage->texture->GetPitch() != PAGE_SIZE * BYTES_PER_PIXEL)
+      return {};
+    std::memset(newPage->texture->GetPixels(), 0,
+                newPage->texture->GetPitch() * newPage->texture->GetRows());
+    newPage->texture->SetAlpha(hasAlpha);
+
+    newPage->alpha = hasAlpha;
+    position = newPage->packer.Insert(slotWidth, slotHeight);
+    page = newPage.get();
+    m_pages.emplace_back(std::move(newPage));
+
+    CLog::Log(LOGDEBUG, "CTextureAtlas: created {} page {}", hasAlpha ? "translucent" : "opaque",
+              m_pages.size());
+  }
+
+  if (!CopyToPage(*page, position->x, position->y, width, height,
+                  pitch ? pitch : width * BYTES_PER_PIXEL, pixels))
+    return {};
+
+  Entry entry{page->texture, static_cast<int>(position->x + GUTTER),
+              static_cast<int>(position->y + GUTTER), static_cast<int>(width),
+              static_cast<int>(height)};
+  m_entries[name] = entry;
+
+  return entry;
+}
+
+bool CTextureAtlas::CopyToPage(Page& page,
+                               unsigned int x,
+                               unsigned int y,
+                               unsigned int width,
+                               unsigned int height,
+                               unsigned int pitch,
+                               const uint8_t* pixels)
+{
+  const unsigned int slotWidth = width + 2 * GUTTER;
+  const unsigned int slotHeight = height + 2 * GUTTER;
+  const unsigned int slotPitch = slotWidth * BYTES_PER_PIXEL;
+  const unsigned int rowBytes = width * BYTES_PER_PIXEL;
+
+  // copy the texture and replicate its outermost pixels into the gutter
+  std::vector<uint8_t> slot(static_cast<size_t>(slotPitch) * slotHeight);
+  for (unsigned int row = 0; row < slotHeight; ++row)
+  {
+    const unsigned int srcRow = row < GUTTER ? 0 : std::min(row - GUTTER, height - 1);
+    const uint8_t* src = pixels + srcRow * pitch;
+    uint8_t* dst = slot.data() + row * slotPitch;
+
+    for (unsigned int i = 0; i < GUTTER; ++i)
+      std::memcpy(dst + i * BYTES_PER_PIXEL, src, BYTES_PER_PIXEL);
+    std::memcpy(dst + GUTTER * BYTES_PER_PIXEL, src, rowBytes);
+    for (unsigned int i = 0; i < GUTTER; ++i)
+      std::memcpy(dst + (GUTTER + width + i) * BYTES_PER_PIXEL,
+                  src + (width - 1) * BYTES_PER_PIXEL, BYTES_PER_PIXEL);
+  }
+
+  // the texture keeps its pixels until the first upload, so textures added
+  // before that only cost a single upload of the page
+  uint8_t* texturePixels = page.texture->GetPixels();
+  if (texturePixels)
+  {
+    const unsigned int pagePitch = page.texture->GetPitch();
+    for (unsigned int row = 0; row < slotHeight; ++row)
+      std::memcpy(texturePixels + (y + row) * pagePitch + x * BYTES_PER_PIXEL,
+                  slot.data() + row * slotPitch, slotPitch);
+    return true;
+  }
+
+  return page.texture->UpdateRect(x, y, slotWidth, slotHeight, slot.data());
+}
+
+void CTextureAtlas::Clear()
+{
+  m_entries.clear();
+  m_pages.clear();
+}
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+\file TextureAtlas.h
+\brief Packing of small GUI textures into shared texture pages.
+*/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class CTexture;
+
+/*!
+ \brief Shelf based rectangle packer.
+
+ Rectangles are placed left to right on horizontal shelves. A new shelf is
+ opened below the last one when no existing shelf has room for a rectangle.
+ Space is never reclaimed, the packer is meant to be filled once and thrown away.
+ */
+class CTextureAtlasPacker
+{
+public:
+  CTextureAtlasPacker(unsigned int width, unsigned int height);
+
+  struct Position
+  {
+    unsigned int x;
+    unsigned int y;
+  };
+
+  /*!
+   \brief Reserve space for a rectangle
+   \param width width of the rectangle
+   \param height height of the rectangle
+   \return the top left corner of the reserved space, or nothing if the rectangle doesn't fit
+   */
+  std::optional<Position> Insert(unsigned int width, unsigned int height);
+
+  unsigned int GetWidth() const { return m_width; }
+  unsigned int GetHeight() const { return m_height; }
+
+  //! area covered by the inserted rectangles
+  uint64_t GetUsedArea() const { return m_usedArea; }
+
+private:
+  struct Shelf
+  {
+    unsigned int y;
+    unsigned int height;
+    unsigned int used;
+  };
+
+  unsigned int m_width;
+  unsigned int m_height;
+  unsigned int m_bottom{0};
+  uint64_t m_usedArea{0};
+  std::vector<Shelf> m_shelves;
+};
+
+/*!
+ \brief Collection of texture pages that small 32 bit textures are packed into.
+
+ Textures that share a page can be drawn without rebinding and merged into the
+ same GUI batch. Every texture is surrounded by a one pixel border replicating
+ its edges, so linear filtering doesn't pick up neighbouring textures.
+
+ Opaque and translucent textures are kept on separate pages, as the GUI renders
+ them in different passes. Entries stay valid until Clear() is called, a texture
+ that is loaded again after being released reuses its existing sub-rectangle.
+
+ No copy of the pages is kept in memory. Textures added before a page got
+ uploaded are copied into its pending pixels, later ones only upload their own
+ sub-rectangle.
+ */
+class CTextureAtlas
+{
+public:
+  static constexpr unsigned int PAGE_SIZE = 1024;
+  static constexpr unsigned int MAX_PAGES = 4;
+  //! textures larger than this in either dimension are not packed
+  static constexpr unsigned int MAX_TEXTURE_SIZE = 128;
+
+  struct Entry
+  {
+    std::shared_ptr<CTexture> page;
+    int x;
+    int y;
+    int width;
+    int height;
+  };
+
+  /*!
+   \brief Check whether a texture of the given size is small enough to be packed
+   */
+  static bool CanPack(unsigned int width, unsigned int height);
+
+  /*!
+   \brief Look up a texture that has been packed before
+   \param name the name the texture was added with
+   */
+  std::optional<Entry> Find(const std::string& name) const;
+
+  /*!
+   \brief Copy a texture into one of the pages
+   \param name name of the texture, used by Find()
+   \param width width of the texture
+   \param height height of the texture
+   \param pitch bytes per row of pixels, 0 for tightly packed rows
+   \param pixels BGRA pixels of the texture
+   \param hasAlpha whether the texture is translucent
+   \return the location of the texture, or nothing if all pages are full or the
+   page can't be updated
+   */
+  std::optional<Entry> Add(const std::string& name,
+                           unsigned int width,
+                           unsigned int height,
+                           unsigned int pitch,
+                           const uint8_t* pixels,
+                           bool hasAlpha);
+
+  /*!
+   \brief Forget all entries and release the pages
+   */
+  void Clear();
+
+  size_t GetPageCount() const { return m_pages.size(); }
+
+private:
+  struct Page
+  {
+    Page() : packer(PAGE_SIZE, PAGE_SIZE) {}
+
+    std::shared_ptr<CTexture> texture;
+    CTextureAtlasPacker packer;
+    bool alpha{false};
+  };
+
+  bool CopyToPage(Page& page,
+                  unsigned int x,
+                  unsigned int y,
+                  unsigned int width,
+                  unsigned int height,
+                  unsigned int pitch,
+                  const uint8_t* pixels);
+
+  std::vector<std::unique_ptr<Page>> m_pages;
+  std::map<std::string, Entry, std::less<>> m_entries;
+};
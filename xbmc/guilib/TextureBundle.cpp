@@ -52,6 +52,15 @@ std::optional<CTextureBundleXBT::Texture> CTextureBundle::LoadTexture(const std:
     return {};
 }
 
+std::optional<CTextureAtlas::Entry> CTextureBundle::LoadTexture(const std::string& filename,
+                                                                CTextureAtlas& atlas)
+{
+  if (m_useXBT)
+    return m_tbXBT.LoadTexture(filename, atlas);
+  else
+    return {};
+}
+
 std::optional<CTextureBundleXBT::Animation> CTextureBundle::LoadAnim(const std::string& filename)
 {
   if (m_useXBT)
@@ -37,6 +37,17 @@ public:
    */
   std::optional<CTextureBundleXBT::Texture> LoadTexture(const std::string& filename);
 
+  /*!
+   * \brief Load texture from bundle into a texture atlas
+   *
+   * \param[in] filename name of the texture to load
+   * \param[in] atlas the atlas to pack the texture into
+   * \return std::optional<CTextureAtlas::Entry> if the texture was packed, nothing if
+   *         it isn't suitable for the atlas or the atlas is full
+   */
+  std::optional<CTextureAtlas::Entry> LoadTexture(const std::string& filename,
+                                                  CTextureAtlas& atlas);
+
   /*!
    * \brief Load animation from bundle
    *
@@ -174,6 +174,46 @@ std::optional<CTextureBundleXBT::Texture> CTextureBundleXBT::LoadTexture(
   return std::make_optional<Texture>(std::move(texture));
 }
 
+std::optional<CTextureAtlas::Entry> CTextureBundleXBT::LoadTexture(const std::string& filename,
+                                                                   CTextureAtlas& atlas)
+{
+  std::string name = Normalize(filename);
+
+  CXBTFFile file;
+  if (!m_XBTFReader->Get(name, file))
+    return {};
+
+  // animated textures are never packed
+  if (file.GetFrames().size() != 1)
+    return {};
+
+  const CXBTFFrame& frame = file.GetFrames().at(0);
+  if (!CTextureAtlas::CanPack(frame.GetWidth(), frame.GetHeight()))
+    return {};
+
+  // only plain 32 bit frames can be copied into the atlas as they are
+  bool hasAlpha;
+  if (frame.GetKDFormatType())
+  {
+    if (frame.GetKDFormat() != KD_TEX_FMT_SDR_BGRA8 || frame.GetKDSwizzle() != KD_TEX_SWIZ_RGBA)
+      return {};
+    hasAlpha = frame.GetKDAlpha() != KD_TEX_ALPHA_OPAQUE;
+  }
+  else if (frame.GetFormat() == XB_FMT_A8R8G8B8)
+    hasAlpha = frame.HasAlpha();
+  else
+    return {};
+
+  std::vector<uint8_t> buffer = UnpackFrame(*m_XBTFReader, frame);
+  if (buffer.size() < static_cast<size_t>(frame.GetWidth()) * frame.GetHeight() * 4)
+  {
+    CLog::Log(LOGERROR, "Error loading texture: {}", filename);
+    return {};
+  }
+
+  return atlas.Add(filename, frame.GetWidth(), frame.GetHeight(), 0, buffer.data(), hasAlpha);
+}
+
 std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const std::string& filename)
 {
   std::string name = Normalize(filename);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Texture.h"
+#include "TextureAtlas.h"
 
 #include <cstdint>
 #include <ctime>
@@ -45,6 +46,12 @@ public:
    */
   std::optional<Texture> LoadTexture(const std::string& filename);
 
+  /*!
+   * \brief See CTextureBundle::LoadTexture
+   */
+  std::optional<CTextureAtlas::Entry> LoadTexture(const std::string& filename,
+                                                  CTextureAtlas& atlas);
+
   struct Animation
   {
     std::vector<std::pair<std::unique_ptr<CTexture>, int>> textures;
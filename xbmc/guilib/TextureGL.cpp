@@ -9,6 +9,7 @@
 #include "TextureGL.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/RenderSystem.h"
@@ -173,6 +174,8 @@ void CGLTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+
+  GUIFRAMEPROFILER_SCOPE("Texture::Upload");
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -288,6 +291,27 @@ void CGLTexture::BindToUnit(unsigned int unit)
   glBindTexture(GL_TEXTURE_2D, m_texture);
 }
 
+bool CGLTexture::UpdateRect(unsigned int x,
+                            unsigned int y,
+                            unsigned int width,
+                            unsigned int height,
+                            const unsigned char* pixels)
+{
+  if (!m_loadedToGPU || m_texture == 0 || !(m_textureFormat & KD_TEX_FMT_SDR) || IsMipmapped())
+    return false;
+
+  const TextureFormat glFormat = GetFormatGL(m_textureFormat);
+  if (glFormat.format == GL_FALSE)
+    return false;
+
+  GUIFRAMEPROFILER_SCOPE("Texture::Upload");
+  glBindTexture(GL_TEXTURE_2D, m_texture);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, glFormat.format, glFormat.type, pixels);
+  VerifyGLState();
+
+  return true;
+}
+
 void CGLTexture::SetSwizzle()
 {
   if (!SwizzleMap.contains(m_textureSwizzle))
@@ -9,6 +9,7 @@
 #include "TextureGLES.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/RenderSystem.h"
@@ -19,6 +20,7 @@
 #include "utils/log.h"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -210,6 +212,8 @@ void CGLESTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+
+  GUIFRAMEPROFILER_SCOPE("Texture::Upload");
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -347,6 +351,45 @@ void CGLESTexture::BindToUnit(unsigned int unit)
   glBindTexture(GL_TEXTURE_2D, m_texture);
 }
 
+bool CGLESTexture::UpdateRect(unsigned int x,
+                              unsigned int y,
+                              unsigned int width,
+                              unsigned int height,
+                              const unsigned char* pixels)
+{
+  // only 32 bit textures, other formats may have been converted on upload
+  if (!m_loadedToGPU || m_texture == 0 || m_textureFormat != KD_TEX_FMT_SDR_BGRA8 ||
+      m_textureSwizzle != KD_TEX_SWIZ_RGBA || IsMipmapped())
+    return false;
+
+  // GLES 3.0 textures are uploaded as RGBA with red and blue swizzled, see LoadToGPU
+  std::vector<unsigned char> swapped;
+  GLenum format = GL_RGBA;
+  if (!m_isGLESVersion30orNewer)
+  {
+#if defined(GL_BGRA_EXT)
+    if (CServiceBroker::GetRenderSystem()->IsExtSupported("GL_EXT_texture_format_BGRA8888") ||
+        CServiceBroker::GetRenderSystem()->IsExtSupported("GL_IMG_texture_format_BGRA8888") ||
+        CServiceBroker::GetRenderSystem()->IsExtSupported("GL_APPLE_texture_format_BGRA8888"))
+      format = GL_BGRA_EXT;
+    else
+#endif
+    {
+      const unsigned int pitch = width * 4;
+      swapped.assign(pixels, pixels + pitch * height);
+      SwapBlueRed(swapped.data(), height, pitch);
+      pixels = swapped.data();
+    }
+  }
+
+  GUIFRAMEPROFILER_SCOPE("Texture::Upload");
+  glBindTexture(GL_TEXTURE_2D, m_texture);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, pixels);
+  VerifyGLState();
+
+  return true;
+}
+
 bool CGLESTexture::SupportsFormat(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle)
 {
   // GLES 3.0 supports swizzles
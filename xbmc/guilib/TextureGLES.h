@@ -38,6 +38,13 @@ public:
   void DestroyTextureObject() override;
   void LoadToGPU() override;
   void BindToUnit(unsigned int unit) override;
+  bool UpdateRect(unsigned int x,
+                  unsigned int y,
+                  unsigned int width,
+                  unsigned int height,
+                  const unsigned char* pixels) override;
+
+  GLuint GetTextureID() const { return m_texture; }
   bool SupportsFormat(KD_TEX_FMT textureFormat, KD_TEX_SWIZ textureSwizzle) override;
 
 protected:
@@ -56,6 +56,8 @@ CTextureArray::CTextureArray(int width, int height, int loops,  bool texCoordsAr
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
   m_texCoordsArePixels = false;
 }
 
@@ -82,6 +84,8 @@ void CTextureArray::Reset()
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
   m_texCoordsArePixels = false;
 }
 
@@ -98,6 +102,14 @@ void CTextureArray::Add(std::shared_ptr<CTexture> texture, int delay)
   m_delays.push_back(delay);
 }
 
+void CTextureArray::Add(const CTextureAtlas::Entry& entry, int delay)
+{
+  assert(!m_textures.size()); // atlas entries can't be animated
+  Add(entry.page, delay);
+  m_texOffsetX = entry.x;
+  m_texOffsetY = entry.y;
+}
+
 void CTextureArray::Set(std::shared_ptr<CTexture> texture, int width, int height)
 {
   assert(!m_textures.size()); // don't try and set a texture if we already have one!
@@ -212,6 +224,14 @@ void CTextureMap::Add(std::unique_ptr<CTexture> texture, int delay)
   m_texture.Add(std::move(texture), delay);
 }
 
+void CTextureMap::Add(const CTextureAtlas::Entry& entry, int delay)
+{
+  // the page itself is shared, only account for our part of it
+  m_memUsage += entry.width * entry.height * 4;
+
+  m_texture.Add(entry, delay);
+}
+
 /************************************************************************/
 /*                                                                      */
 /************************************************************************/
@@ -428,20 +448,33 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   }
 
   std::unique_ptr<CTexture> pTexture;
+  std::optional<CTextureAtlas::Entry> atlasEntry;
   int width = 0, height = 0;
   if (bundle >= 0)
   {
-    std::optional<CTextureBundleXBT::Texture> texture =
-        m_TexBundle[bundle].LoadTexture(strTextureName);
-    if (!texture)
+    atlasEntry = m_atlas.Find(strTextureName);
+    if (!atlasEntry)
+      atlasEntry = m_TexBundle[bundle].LoadTexture(strTextureName, m_atlas);
+
+    if (atlasEntry)
     {
-      CLog::Log(LOGERROR, "Texture manager unable to load bundled file: {}", strTextureName);
-      return emptyTexture;
+      width = atlasEntry->width;
+      height = atlasEntry->height;
     }
+    else
+    {
+      std::optional<CTextureBundleXBT::Texture> texture =
+          m_TexBundle[bundle].LoadTexture(strTextureName);
+      if (!texture)
+      {
+        CLog::Log(LOGERROR, "Texture manager unable to load bundled file: {}", strTextureName);
+        return emptyTexture;
+      }
 
-    pTexture = std::move(texture.value().texture);
-    width = texture.value().width;
-    height = texture.value().height;
+      pTexture = std::move(texture.value().texture);
+      width = texture.value().width;
+      height = texture.value().height;
+    }
   }
   else
   {
@@ -452,10 +485,14 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
     height = pTexture->GetHeight();
   }
 
-  if (!pTexture) return emptyTexture;
+  if (!pTexture && !atlasEntry)
+    return emptyTexture;
 
   CTextureMap* pMap = new CTextureMap(strTextureName, width, height, 0);
-  pMap->Add(std::move(pTexture), 100);
+  if (atlasEntry)
+    pMap->Add(*atlasEntry, 100);
+  else
+    pMap->Add(std::move(pTexture), 100);
   m_vecTextures.push_back(pMap);
 
 #ifdef _DEBUG_TEXTURES
@@ -551,6 +588,7 @@ void CGUITextureManager::Cleanup()
     delete pMap;
     i = m_vecTextures.erase(i);
   }
+  m_atlas.Clear();
   m_TexBundle[0].Close();
   m_TexBundle[1].Close();
   m_TexBundle[0] = CTextureBundle(true);
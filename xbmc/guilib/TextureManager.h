@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GUIComponent.h"
+#include "TextureAtlas.h"
 #include "TextureBundle.h"
 #include "threads/CriticalSection.h"
 
@@ -37,6 +38,7 @@ public:
   void Reset();
 
   void Add(std::shared_ptr<CTexture> texture, int delay);
+  void Add(const CTextureAtlas::Entry& entry, int delay);
   void Set(std::shared_ptr<CTexture> texture, int width, int height);
   void Free();
   unsigned int size() const;
@@ -49,6 +51,8 @@ public:
   int m_loops;
   int m_texWidth;
   int m_texHeight;
+  int m_texOffsetX; ///< position of the frames within the texture, non-zero for atlas entries
+  int m_texOffsetY;
   bool m_texCoordsArePixels;
 };
 
@@ -67,6 +71,7 @@ public:
   virtual ~CTextureMap();
 
   void Add(std::unique_ptr<CTexture> texture, int delay);
+  void Add(const CTextureAtlas::Entry& entry, int delay);
   bool Release();
 
   const std::string& GetName() const;
@@ -124,6 +129,8 @@ protected:
   typedef std::vector<CTextureMap*>::iterator ivecTextures;
   // we have 2 texture bundles (one for the base textures, one for the theme)
   CTextureBundle m_TexBundle[2];
+  // small bundled textures are packed into shared pages
+  CTextureAtlas m_atlas;
 
   std::vector<std::string> m_texturePaths;
   CCriticalSection m_section;
@@ -113,6 +113,17 @@ bool CGUIInfoProviders::GetBool(bool& value, const CGUIListItem *item, int conte
   return false;
 }
 
+const InfoChangeCounter* CGUIInfoProviders::GetChangeCounter(const CGUIInfo& info) const
+{
+  for (const auto& provider : m_providers)
+  {
+    const InfoChangeCounter* counter = provider->GetChangeCounter(info);
+    if (counter)
+      return counter;
+  }
+  return nullptr;
+}
+
 void CGUIInfoProviders::UpdateAVInfo(const AudioStreamInfo& audioInfo, const VideoStreamInfo& videoInfo, const SubtitleStreamInfo& subtitleInfo)
 {
   for (const auto& provider : m_providers)
@@ -97,6 +97,13 @@ public:
    */
   bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const;
 
+  /*!
+   * @brief Get the change counter of a GUIInfoManager bool value from one of the registered providers.
+   * @param info The GUI info (label id + additional data).
+   * @return The change counter if one of the providers notifies changes of the value, nullptr if it has to be polled.
+   */
+  const InfoChangeCounter* GetChangeCounter(const CGUIInfo& info) const;
+
   /*!
    * @brief Set new audio/video/subtitle stream info data at all registered providers.
    * @param audioInfo New audio stream info.
@@ -135,6 +142,12 @@ public:
    */
   CLibraryGUIInfo& GetLibraryInfoProvider() { return m_libraryGUIInfo; }
 
+  /*!
+   * @brief Get the skin guiinfo provider.
+   * @return The skin guiinfo provider.
+   */
+  CSkinGUIInfo& GetSkinInfoProvider() { return m_skinGUIInfo; }
+
 private:
   std::vector<IGUIInfoProvider *> m_providers;
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 class CFileItem;
@@ -25,6 +26,11 @@ namespace GUIINFO
 
 class CGUIInfo;
 
+/*!
+ * @brief Counter increased by a guiinfo provider whenever values it notifies changes for may have changed.
+ */
+using InfoChangeCounter = std::atomic<unsigned int>;
+
 class IGUIInfoProvider
 {
 public:
@@ -84,6 +90,14 @@ public:
    */
   virtual bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const = 0;
 
+  /*!
+   * @brief Get the change counter of a GUIInfoManager bool value. Values with a change counter
+   * only need to be evaluated again after the counter was increased, all others are polled every frame.
+   * @param info The GUI info (label id + additional data).
+   * @return The change counter if the provider notifies changes of the value, nullptr otherwise.
+   */
+  virtual const InfoChangeCounter* GetChangeCounter(const CGUIInfo& info) const = 0;
+
   /*!
    * @brief Set new audio/video stream info data.
    * @param audioInfo New audio stream info.
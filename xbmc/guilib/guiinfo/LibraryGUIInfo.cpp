@@ -41,6 +41,8 @@ bool CLibraryGUIInfo::GetLibraryBool(int condition) const
 
 void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
 {
+  ++m_changeCounter;
+
   switch (condition)
   {
     case LIBRARY_HAS_MUSIC:
@@ -74,6 +76,8 @@ void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
 
 void CLibraryGUIInfo::ResetLibraryBools()
 {
+  ++m_changeCounter;
+
   m_libraryHasMusic = -1;
   m_libraryHasMovies = -1;
   m_libraryHasTVShows = -1;
@@ -85,6 +89,26 @@ void CLibraryGUIInfo::ResetLibraryBools()
   m_libraryRoleCounts.clear();
 }
 
+const InfoChangeCounter* CLibraryGUIInfo::GetChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.m_info)
+  {
+    // cached library content, only changes when the library bools are set or reset
+    case LIBRARY_HAS_MUSIC:
+    case LIBRARY_HAS_VIDEO:
+    case LIBRARY_HAS_MOVIES:
+    case LIBRARY_HAS_MOVIE_SETS:
+    case LIBRARY_HAS_TVSHOWS:
+    case LIBRARY_HAS_MUSICVIDEOS:
+    case LIBRARY_HAS_SINGLES:
+    case LIBRARY_HAS_COMPILATIONS:
+    case LIBRARY_HAS_BOXSETS:
+    case LIBRARY_HAS_ROLE:
+      return &m_changeCounter;
+  }
+  return nullptr;
+}
+
 bool CLibraryGUIInfo::InitCurrentItem(CFileItem *item)
 {
   return false;
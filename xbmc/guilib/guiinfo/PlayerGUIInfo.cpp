@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "PlayListPlayer.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "URL.h"
 #include "Util.h"
 #include "application/Application.h"
@@ -30,6 +31,7 @@
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
+#include "video/VideoTrickplay.h"
 
 #include "platform/linux/SysfsPath.h"
 
@@ -172,6 +174,30 @@ std::string CPlayerGUIInfo::GetCurrentSeekTime(TIME_FORMAT format) const
       g_application.GetTime() + m_appPlayer->GetSeekHandler().GetSeekSize(), format);
 }
 
+std::string CPlayerGUIInfo::GetSeekPreview(const CFileItem* item) const
+{
+  namespace TRICKPLAY = KODI::VIDEO::TRICKPLAY;
+
+  if (!item || m_trickplayLayout.tiles == 0 || item->GetDynPath() != m_trickplayPath ||
+      !m_appPlayer->HasVideo() || !m_appPlayer->GetSeekHandler().InProgress())
+    return {};
+
+  std::chrono::milliseconds seekTime(
+      std::llround((g_application.GetTime() + m_appPlayer->GetSeekHandler().GetSeekSize()) * 1000));
+
+  // the player time has the cuts of the edit list removed, the sprite covers the whole file
+  for (const auto& edit : CServiceBroker::GetDataCacheCore().GetEditList())
+  {
+    if (edit.action == EDL::Action::CUT && seekTime > edit.start)
+      seekTime += edit.end - edit.start;
+  }
+
+  const int seconds =
+      static_cast<int>(std::chrono::duration_cast<std::chrono::seconds>(seekTime).count());
+  return TRICKPLAY::GetTileURL(m_trickplayPath, m_trickplayLayout,
+                               TRICKPLAY::GetTile(m_trickplayLayout, seconds));
+}
+
 std::string CPlayerGUIInfo::GetSeekTime(TIME_FORMAT format) const
 {
   if (!m_appPlayer->GetSeekHandler().HasTimeCode())
@@ -205,10 +231,19 @@ bool CPlayerGUIInfo::InitCurrentItem(CFileItem *item)
   {
     CLog::Log(LOGDEBUG, "CPlayerGUIInfo::InitCurrentItem({})", CURL::GetRedacted(item->GetPath()));
     m_currentItem = std::make_unique<CFileItem>(*item);
+
+    // previews only come from a sprite generated before, never while playing
+    m_trickplayPath = item->GetDynPath();
+    m_trickplayLayout = {};
+    if (CServiceBroker::GetTextureCache()->HasCachedImage(
+            VIDEO::TRICKPLAY::GetSpriteURL(m_trickplayPath)))
+      m_trickplayLayout = VIDEO::TRICKPLAY::GetStoredLayout(m_trickplayPath);
   }
   else
   {
     m_currentItem.reset();
+    m_trickplayPath.clear();
+    m_trickplayLayout = {};
   }
   return false;
 }
@@ -326,6 +361,9 @@ bool CPlayerGUIInfo::GetLabel(std::string& value, const CFileItem *item, int con
         value = "+" + strSeekSize;
       return true;
     }
+    case PLAYER_SEEKPREVIEW:
+      value = GetSeekPreview(item);
+      return true;
     case PLAYER_SEEKNUMERIC:
       value = GetSeekTime(static_cast<TIME_FORMAT>(info.GetData1()));
       return !value.empty();
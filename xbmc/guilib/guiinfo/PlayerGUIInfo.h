@@ -11,10 +11,12 @@
 #include "guilib/guiinfo/GUIInfoProvider.h"
 #include "utils/EventStream.h"
 #include "utils/TimeFormat.h"
+#include "video/VideoTrickplay.h"
 
 #include <atomic>
 #include <ctime>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -70,6 +72,7 @@ private:
   std::string GetDuration(TIME_FORMAT format) const;
   std::string GetCurrentSeekTime(TIME_FORMAT format) const;
   std::string GetSeekTime(TIME_FORMAT format) const;
+  std::string GetSeekPreview(const CFileItem* item) const;
 
   std::string GetContentRanges(int iInfo) const;
   std::vector<std::pair<float, float>> GetEditList(const CDataCacheCore& data,
@@ -82,6 +85,8 @@ private:
                                                    std::time_t duration) const;
 
   std::unique_ptr<CFileItem> m_currentItem;
+  VIDEO::TRICKPLAY::Layout m_trickplayLayout; //!< no tiles if the sprite is not cached
+  std::string m_trickplayPath;
   std::atomic_bool m_playerShowTime{false};
   std::atomic_bool m_playerShowInfo{false};
   const std::shared_ptr<CApplicationPlayer> m_appPlayer;
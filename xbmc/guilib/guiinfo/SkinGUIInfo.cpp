@@ -138,3 +138,16 @@ bool CSkinGUIInfo::GetBool(bool& value, const CGUIListItem *gitem, int contextWi
 
   return false;
 }
+
+const InfoChangeCounter* CSkinGUIInfo::GetChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.m_info)
+  {
+    // skin settings, only change through the skin settings
+    case SKIN_BOOL:
+    case SKIN_STRING_IS_EQUAL:
+    case SKIN_STRING:
+      return &m_settingsChangeCounter;
+  }
+  return nullptr;
+}
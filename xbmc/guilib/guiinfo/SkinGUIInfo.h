@@ -30,6 +30,15 @@ public:
   bool GetLabel(std::string& value, const CFileItem *item, int contextWindow, const CGUIInfo &info, std::string *fallback) const override;
   bool GetInt(int& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const override;
   bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const override;
+  const InfoChangeCounter* GetChangeCounter(const CGUIInfo& info) const override;
+
+  /*!
+   * @brief Notify that skin settings have been changed, loaded or reset.
+   */
+  void NotifySettingsChanged() { ++m_settingsChangeCounter; }
+
+private:
+  InfoChangeCounter m_settingsChangeCounter{0};
 };
 
 } // namespace GUIINFO
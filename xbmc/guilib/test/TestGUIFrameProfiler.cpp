@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameProfiler.h"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestGUIFrameProfiler, RanksControlsBySelfTime)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  profiler.Start();
+  ASSERT_TRUE(CGUIFrameProfiler::IsRunning());
+
+  profiler.EndFrame();
+  {
+    CGUIFrameProfiler::CScope group("Control::Render", 1, 0);
+    std::this_thread::sleep_for(2ms);
+    {
+      CGUIFrameProfiler::CScope child("Control::Render", 2, 0);
+      std::this_thread::sleep_for(10ms);
+    }
+  }
+  profiler.EndFrame();
+  profiler.Stop();
+
+  auto costs = profiler.GetControlCosts(1, 5);
+  ASSERT_EQ(2u, costs.size());
+
+  // the time of the child isn't counted against the group
+  EXPECT_EQ(2, costs[0].controlId);
+  EXPECT_EQ(1, costs[1].controlId);
+  EXPECT_GE(costs[0].selfTime, 10.0);
+  EXPECT_LT(costs[1].selfTime, costs[0].selfTime);
+
+  auto frameTimes = profiler.GetFrameTimes();
+  ASSERT_EQ(1u, frameTimes.size());
+  EXPECT_GE(frameTimes[0], 12.0f);
+}
+
+TEST(TestGUIFrameProfiler, IgnoresScopesWhileStopped)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  profiler.Start();
+  profiler.Stop();
+
+  profiler.EndFrame();
+  {
+    CGUIFrameProfiler::CScope scope("Control::Render", 1, 0);
+  }
+  profiler.EndFrame();
+
+  EXPECT_TRUE(profiler.GetFrameTimes().empty());
+  EXPECT_TRUE(profiler.GetControlCosts(1, 5).empty());
+}
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIQuadBatch.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+GUIQuadBatchState MakeState(unsigned int texture)
+{
+  GUIQuadBatchState state;
+  state.shader = 1;
+  state.texture = texture;
+  state.color = {255, 255, 255, 255};
+  state.depth = 0.5f;
+  return state;
+}
+
+void MakeQuad(CGUIQuadBatch::Vertex (&vertices)[4], float offset)
+{
+  for (int i = 0; i < 4; i++)
+    vertices[i] = {offset + i, offset + i, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+}
+} // namespace
+
+TEST(TestGUIQuadBatch, MergesQuadsWithSameState)
+{
+  CGUIQuadBatch batch;
+  CGUIQuadBatch::Vertex vertices[4];
+  MakeQuad(vertices, 0.0f);
+
+  EXPECT_TRUE(batch.IsEmpty());
+  ASSERT_TRUE(batch.CanAppend(MakeState(1), 1));
+  batch.Append(MakeState(1), vertices, 4);
+  ASSERT_TRUE(batch.CanAppend(MakeState(1), 1));
+  batch.Append(MakeState(1), vertices, 4);
+
+  EXPECT_EQ(2u, batch.GetQuadCount());
+  ASSERT_EQ(12u, batch.GetIndices().size());
+  const std::vector<uint16_t> expected = {0, 1, 2, 2, 3, 0, 4, 5, 6, 6, 7, 4};
+  EXPECT_EQ(expected, batch.GetIndices());
+}
+
+TEST(TestGUIQuadBatch, RejectsDifferentState)
+{
+  CGUIQuadBatch batch;
+  CGUIQuadBatch::Vertex vertices[4];
+  MakeQuad(vertices, 0.0f);
+  batch.Append(MakeState(1), vertices, 4);
+
+  EXPECT_FALSE(batch.CanAppend(MakeState(2), 1));
+
+  GUIQuadBatchState blended = MakeState(1);
+  blended.blending = false;
+  EXPECT_FALSE(batch.CanAppend(blended, 1));
+
+  GUIQuadBatchState deeper = MakeState(1);
+  deeper.depth = 0.25f;
+  EXPECT_FALSE(batch.CanAppend(deeper, 1));
+}
+
+TEST(TestGUIQuadBatch, LimitsQuadCount)
+{
+  CGUIQuadBatch batch;
+  EXPECT_TRUE(batch.CanAppend(MakeState(1), CGUIQuadBatch::MAX_QUADS));
+  EXPECT_FALSE(batch.CanAppend(MakeState(1), CGUIQuadBatch::MAX_QUADS + 1));
+
+  CGUIQuadBatch::Vertex vertices[4];
+  MakeQuad(vertices, 0.0f);
+  batch.Append(MakeState(1), vertices, 4);
+  EXPECT_FALSE(batch.CanAppend(MakeState(1), CGUIQuadBatch::MAX_QUADS));
+}
+
+TEST(TestGUIQuadBatch, ClearResetsBatch)
+{
+  CGUIQuadBatch batch;
+  CGUIQuadBatch::Vertex vertices[4];
+  MakeQuad(vertices, 0.0f);
+  batch.Append(MakeState(1), vertices, 4);
+  batch.Clear();
+
+  EXPECT_TRUE(batch.IsEmpty());
+  EXPECT_TRUE(batch.GetIndices().empty());
+  EXPECT_TRUE(batch.CanAppend(MakeState(2), 1));
+}
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/TextureAtlas.h"
+
+#include <gtest/gtest.h>
+
+TEST(TestTextureAtlas, PacksRectanglesOnShelves)
+{
+  CTextureAtlasPacker packer(64, 64);
+
+  auto first = packer.Insert(32, 16);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(0u, first->x);
+  EXPECT_EQ(0u, first->y);
+
+  auto second = packer.Insert(32, 16);
+  ASSERT_TRUE(second);
+  EXPECT_EQ(32u, second->x);
+  EXPECT_EQ(0u, second->y);
+
+  // first shelf is full, a new one is opened below it
+  auto third = packer.Insert(16, 8);
+  ASSERT_TRUE(third);
+  EXPECT_EQ(0u, third->x);
+  EXPECT_EQ(16u, third->y);
+
+  EXPECT_EQ(32u * 16 * 2 + 16 * 8, packer.GetUsedArea());
+}
+
+TEST(TestTextureAtlas, PrefersTightestShelf)
+{
+  CTextureAtlasPacker packer(64, 64);
+
+  ASSERT_TRUE(packer.Insert(48, 32));
+  ASSERT_TRUE(packer.Insert(32, 8));
+
+  // fits on both shelves, the 8 pixel one wastes less
+  auto position = packer.Insert(16, 8);
+  ASSERT_TRUE(position);
+  EXPECT_EQ(32u, position->x);
+  EXPECT_EQ(32u, position->y);
+}
+
+TEST(TestTextureAtlas, RejectsWhenFull)
+{
+  CTextureAtlasPacker packer(32, 32);
+
+  EXPECT_FALSE(packer.Insert(33, 1));
+  EXPECT_FALSE(packer.Insert(0, 1));
+
+  for (unsigned int i = 0; i < 4; i++)
+    ASSERT_TRUE(packer.Insert(32, 8));
+
+  EXPECT_FALSE(packer.Insert(1, 1));
+}
+
+TEST(TestTextureAtlas, OnlyPacksSmallTextures)
+{
+  EXPECT_TRUE(CTextureAtlas::CanPack(1, 1));
+  EXPECT_TRUE(CTextureAtlas::CanPack(CTextureAtlas::MAX_TEXTURE_SIZE,
+                                     CTextureAtlas::MAX_TEXTURE_SIZE));
+  EXPECT_FALSE(CTextureAtlas::CanPack(CTextureAtlas::MAX_TEXTURE_SIZE + 1, 1));
+  EXPECT_FALSE(CTextureAtlas::CanPack(0, 16));
+}
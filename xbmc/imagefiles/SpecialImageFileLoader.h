@@ -29,6 +29,11 @@ class ISpecialImageFileLoader
 public:
   virtual bool CanLoad(const std::string& specialType) const = 0;
   virtual std::unique_ptr<CTexture> Load(const CImageFileURL& imageFile) const = 0;
+  /*!
+   * @brief Whether a loaded image should be stored in the texture cache, false for images
+   * that are cheaply derived from other cached images.
+   */
+  virtual bool IsCacheable(const CImageFileURL& imageFile) const { return true; }
   virtual ~ISpecialImageFileLoader() = default;
 };
 
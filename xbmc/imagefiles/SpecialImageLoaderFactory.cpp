@@ -43,3 +43,15 @@ std::unique_ptr<CTexture> CSpecialImageLoaderFactory::Load(const CImageFileURL&
   }
   return {};
 }
+
+bool CSpecialImageLoaderFactory::IsCacheable(const CImageFileURL& imageFile) const
+{
+  if (!imageFile.IsSpecialImage())
+    return true;
+  for (auto& loader : m_specialImageLoaders)
+  {
+    if (loader->CanLoad(imageFile.GetSpecialType()) && !loader->IsCacheable(imageFile))
+      return false;
+  }
+  return true;
+}
@@ -26,6 +26,7 @@ public:
   CSpecialImageLoaderFactory();
 
   std::unique_ptr<CTexture> Load(const CImageFileURL& imageFile) const;
+  bool IsCacheable(const CImageFileURL& imageFile) const;
 
 private:
   std::array<std::unique_ptr<ISpecialImageFileLoader>, 5> m_specialImageLoaders{};
@@ -381,6 +381,7 @@ constexpr const int ACTION_SCAN_ITEM = 201; //!< scan item
 constexpr const int ACTION_TOGGLE_DIGITAL_ANALOG = 202; //!< switch digital <-> analog
 constexpr const int ACTION_RELOAD_KEYMAPS = 203; //!< reloads CButtonTranslator's keymaps
 constexpr const int ACTION_GUIPROFILE_BEGIN = 204; //!< start the GUIControlProfiler running
+constexpr const int ACTION_FRAMEPROFILE_TOGGLE = 205; //!< start/stop the GUIFrameProfiler
 
 //! Teletext Color button <b>Red</b> to control TopText
 constexpr const int ACTION_TELETEXT_RED = 215;
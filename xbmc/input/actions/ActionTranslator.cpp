@@ -187,6 +187,7 @@ static const std::map<ActionName, ActionID> ActionMappings = {
     {"firstpage", ACTION_FIRST_PAGE},
     {"lastpage", ACTION_LAST_PAGE},
     {"guiprofile", ACTION_GUIPROFILE_BEGIN},
+    {"frameprofile", ACTION_FRAMEPROFILE_TOGGLE},
     {"red", ACTION_TELETEXT_RED},
     {"green", ACTION_TELETEXT_GREEN},
     {"yellow", ACTION_TELETEXT_YELLOW},
@@ -8,8 +8,11 @@
 
 #include "InfoBool.h"
 
+#include "GUIInfoManager.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
+
 namespace INFO
 {
 InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
@@ -17,4 +20,36 @@ InfoBool::InfoBool(const std::string& expression, int context, unsigned int& ref
 {
   StringUtils::ToLower(m_expression);
 }
+
+void InfoBool::SetDependencies(Dependencies dependencies)
+{
+  // a full cache reset invalidates everything
+  dependencies.emplace_back(&m_infoMgr->GetCacheResetCounter());
+
+  std::sort(dependencies.begin(), dependencies.end());
+  dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+  m_dependencies = std::move(dependencies);
+  m_polled = false;
+}
+
+void InfoBool::Evaluate(int contextWindow, const CGUIListItem* item)
+{
+  m_infoMgr->CountEvaluation();
+  Update(contextWindow, item);
+}
+
+bool InfoBool::DependenciesChanged()
+{
+  // the counters only ever increase, so their sum changes whenever one of them does
+  unsigned int stamp = 0;
+  for (const auto* counter : m_dependencies)
+    stamp += counter->load(std::memory_order_relaxed);
+
+  if (stamp == m_dependencyStamp)
+    return false;
+
+  m_dependencyStamp = stamp;
+  return true;
+}
 }
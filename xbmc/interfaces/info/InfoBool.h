@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 class CGUIListItem;
 class CGUIInfoManager;
@@ -36,10 +38,12 @@ public:
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
-      Update(contextWindow, item);
+      Evaluate(contextWindow, item);
     else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
     {
-      Update(contextWindow, nullptr);
+      // values driven by change notifications are only evaluated again if their inputs changed
+      if (m_polled || DependenciesChanged() || m_refreshCounter == 0)
+        Evaluate(contextWindow, nullptr);
       m_refreshCounter = m_parentRefreshCounter;
     }
     return m_value;
@@ -68,7 +72,22 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  typedef std::vector<const std::atomic<unsigned int>*> Dependencies;
+
+  /*! \brief Whether this info bool has to be evaluated every frame
+   \sa SetDependencies
+   */
+  bool IsPolled() const { return m_polled; }
+  const Dependencies& GetDependencies() const { return m_dependencies; }
+
 protected:
+  /*! \brief Only evaluate this info bool again after one of the given change counters was increased.
+   Called from Initialize() for info bools whose inputs are all driven by change notifications.
+   \param dependencies the change counters of the inputs
+   */
+  void SetDependencies(Dependencies dependencies);
+
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
@@ -76,8 +95,14 @@ protected:
   CGUIInfoManager* m_infoMgr;
 
 private:
+  void Evaluate(int contextWindow, const CGUIListItem* item);
+  bool DependenciesChanged();
+
   unsigned int m_refreshCounter = 0;
   unsigned int &m_parentRefreshCounter;
+  bool m_polled = true;
+  Dependencies m_dependencies;
+  unsigned int m_dependencyStamp = 0;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
@@ -21,6 +21,13 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+
+  if (!m_listItemDependent)
+  {
+    const auto* counter = m_infoMgr->GetChangeCounter(m_condition);
+    if (counter)
+      SetDependencies({counter});
+  }
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -39,6 +46,11 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+
+  // the expression only needs to be polled if one of its leaves does
+  Dependencies dependencies;
+  if (!m_listItemDependent && m_expression_tree->CollectDependencies(dependencies))
+    SetDependencies(std::move(dependencies));
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -72,6 +84,16 @@ bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* i
   return m_invert ^ m_info->Get(contextWindow, item);
 }
 
+bool InfoExpression::InfoLeaf::CollectDependencies(Dependencies& dependencies) const
+{
+  if (m_info->IsPolled())
+    return false;
+
+  const Dependencies& leafDependencies = m_info->GetDependencies();
+  dependencies.insert(dependencies.end(), leafDependencies.begin(), leafDependencies.end());
+  return true;
+}
+
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
     node_type_t type,
     const InfoSubexpressionPtr &left,
@@ -115,6 +137,16 @@ bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGU
   return use_and ^ result;
 }
 
+bool InfoExpression::InfoAssociativeGroup::CollectDependencies(Dependencies& dependencies) const
+{
+  for (const auto& child : m_children)
+  {
+    if (!child->CollectDependencies(dependencies))
+      return false;
+  }
+  return true;
+}
+
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
  * (AND/OR) are treated as right-associative so that we don't need to make a
  * special case for the unary NOT operator. This has no effect upon the answers
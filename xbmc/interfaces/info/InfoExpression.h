@@ -76,6 +76,10 @@ private:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
     virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
+    /*! \brief Collect the change counters the value of this subexpression depends on
+     \return false if the subexpression has to be polled
+     */
+    virtual bool CollectDependencies(Dependencies& dependencies) const = 0;
   };
 
   typedef std::shared_ptr<InfoSubexpression> InfoSubexpressionPtr;
@@ -87,6 +91,7 @@ private:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
     bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    bool CollectDependencies(Dependencies& dependencies) const override;
 
   private:
     InfoPtr m_info;
@@ -102,6 +107,7 @@ private:
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
     bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    bool CollectDependencies(Dependencies& dependencies) const override;
 
   private:
     node_type_t m_type;
@@ -11,6 +11,7 @@
 #include "AudioLibrary.h"
 #include "FileItemList.h"
 #include "FileOperations.h"
+#include "JSONStreamedResult.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "VideoLibrary.h"
@@ -333,6 +334,92 @@ void CFileItemHandler::HandleFileItemList(const char *ID, bool allowFile, const
   delete thumbLoader;
 }
 
+void CFileItemHandler::StreamFileItemList(const char* ID,
+                                          bool allowFile,
+                                          const char* resultname,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          bool sortLimit /* = true */)
+{
+  StreamFileItemList(ID, allowFile, resultname, items, parameterObject, result, items.Size(),
+                     sortLimit);
+}
+
+void CFileItemHandler::StreamFileItemList(const char* ID,
+                                          bool allowFile,
+                                          const char* resultname,
+                                          CFileItemList& items,
+                                          const CVariant& parameterObject,
+                                          CVariant& result,
+                                          int size,
+                                          bool sortLimit /* = true */)
+{
+  CStreamedResult* streamed = CStreamedResult::GetCurrent();
+  if (!streamed || !streamed->IsResult(result))
+  {
+    HandleFileItemList(ID, allowFile, resultname, items, parameterObject, result, size, sortLimit);
+    return;
+  }
+
+  int start, end;
+  HandleLimits(parameterObject, result, size, start, end);
+
+  if (sortLimit)
+    Sort(items, parameterObject);
+  else
+  {
+    start = 0;
+    end = items.Size();
+  }
+
+  // the items are written after the method returned, keep them and the parameters alive
+  auto list = std::make_shared<CFileItemList>();
+  list->Assign(items);
+  const std::string strID = ID ? ID : "";
+  const bool hasID = ID != nullptr;
+  const std::string strResultName = resultname;
+
+  streamed->SetMember(
+      resultname,
+      [=](CJSONVariantStreamWriter& writer)
+      {
+        std::unique_ptr<CThumbLoader> thumbLoader;
+        if (end - start > 0)
+        {
+          if (list->Get(start)->HasVideoInfoTag())
+            thumbLoader = std::make_unique<CVideoThumbLoader>();
+          else if (list->Get(start)->HasMusicInfoTag())
+            thumbLoader = std::make_unique<CMusicThumbLoader>();
+
+          if (thumbLoader)
+            thumbLoader->OnLoaderStart();
+        }
+
+        std::set<std::string> fields;
+        if (parameterObject.isMember("properties") && parameterObject["properties"].isArray())
+        {
+          for (CVariant::const_iterator_array field = parameterObject["properties"].begin_array();
+               field != parameterObject["properties"].end_array(); ++field)
+            fields.insert(field->asString());
+        }
+
+        if (!writer.StartArray())
+          return false;
+
+        for (int i = start; i < end; i++)
+        {
+          CVariant object;
+          HandleFileItem(hasID ? strID.c_str() : nullptr, allowFile, strResultName.c_str(),
+                         list->Get(i), parameterObject, fields, object, false, thumbLoader.get());
+          if (!writer.Write(object[strResultName]))
+            return false;
+        }
+
+        return writer.EndArray();
+      });
+}
+
 void CFileItemHandler::HandleFileItem(const char* ID,
                                       bool allowFile,
                                       const char* resultname,
@@ -32,6 +32,26 @@ namespace JSONRPC
                             CThumbLoader* thumbLoader = nullptr);
     static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool sortLimit = true);
     static void HandleFileItemList(const char *ID, bool allowFile, const char *resultname, CFileItemList &items, const CVariant &parameterObject, CVariant &result, int size, bool sortLimit = true);
+    /*!
+     \brief Same as HandleFileItemList() but the items are written to the
+     response one by one once the method returned, if it can be streamed
+     and the list is a direct member of the result of the method.
+     */
+    static void StreamFileItemList(const char* ID,
+                                   bool allowFile,
+                                   const char* resultname,
+                                   CFileItemList& items,
+                                   const CVariant& parameterObject,
+                                   CVariant& result,
+                                   bool sortLimit = true);
+    static void StreamFileItemList(const char* ID,
+                                   bool allowFile,
+                                   const char* resultname,
+                                   CFileItemList& items,
+                                   const CVariant& parameterObject,
+                                   CVariant& result,
+                                   int size,
+                                   bool sortLimit = true);
     static void HandleFileItem(const char* ID,
                                bool allowFile,
                                const char* resultname,
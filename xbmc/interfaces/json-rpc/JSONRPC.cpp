@@ -10,6 +10,8 @@
 
 #include "FileItem.h"
 #include "GUIUserMessages.h"
+#include "JSONResultCache.h"
+#include "JSONStreamedResult.h"
 #include "ServiceBroker.h"
 #include "ServiceDescription.h"
 #include "TextureDatabase.h"
@@ -26,20 +28,52 @@
 #include "interfaces/AnnouncementManager.h"
 #include "playlists/SmartPlayList.h"
 #include "settings/AdvancedSettings.h"
+#include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "settings/lib/SettingsManager.h"
+#include "utils/ParallelFor.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #include <string.h>
+#include <vector>
 
 using namespace KODI;
 using namespace JSONRPC;
 
+namespace
+{
+// calls of a batch handled at the same time, they mostly wait for the databases
+constexpr unsigned int MAX_CONCURRENT_CALLS = 4;
+} // unnamed namespace
+
 bool CJSONRPC::m_initialized = false;
+CResultCache CJSONRPC::m_resultCache;
 
 void CJSONRPC::Initialize()
 {
+  // called again when a profile is loaded, which comes with its own library and settings
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  const auto advancedSettings = settingsComponent->GetAdvancedSettings();
+
+  // shared databases are changed by other clients without announcing it here
+  int libraries = ANNOUNCEMENT::AudioLibrary | ANNOUNCEMENT::VideoLibrary;
+  if (StringUtils::EqualsNoCase(advancedSettings->m_databaseMusic.type, "mysql"))
+    libraries &= ~ANNOUNCEMENT::AudioLibrary;
+  if (StringUtils::EqualsNoCase(advancedSettings->m_databaseVideo.type, "mysql"))
+    libraries &= ~ANNOUNCEMENT::VideoLibrary;
+
+  m_resultCache.Configure(static_cast<size_t>(advancedSettings->m_jsonCacheSize) * 1024 * 1024,
+                          advancedSettings->m_jsonCachedMethods, libraries);
+
+  const auto settings = settingsComponent->GetSettings();
+  if (settings)
+  {
+    settings->GetSettingsManager()->UnregisterCallback(&m_resultCache);
+    settings->GetSettingsManager()->RegisterCallback(&m_resultCache, CResultCache::GetSettings());
+  }
+
   if (m_initialized)
     return;
 
@@ -113,6 +147,9 @@ void CJSONRPC::Initialize()
 
   CJSONServiceDescription::ResolveReferences();
 
+  if (CServiceBroker::GetAnnouncementManager())
+    CServiceBroker::GetAnnouncementManager()->AddAnnouncer(&m_resultCache);
+
   m_initialized = true;
   CLog::Log(LOGINFO, "JSONRPC v{}: Successfully initialized",
             CJSONServiceDescription::GetVersion());
@@ -120,6 +157,13 @@ void CJSONRPC::Initialize()
 
 void CJSONRPC::Cleanup()
 {
+  if (m_initialized && CServiceBroker::GetAnnouncementManager())
+    CServiceBroker::GetAnnouncementManager()->RemoveAnnouncer(&m_resultCache);
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (settingsComponent && settingsComponent->GetSettings())
+    settingsComponent->GetSettings()->GetSettingsManager()->UnregisterCallback(&m_resultCache);
+  m_resultCache.Clear();
+
   CJSONServiceDescription::Cleanup();
   m_initialized = false;
 }
@@ -241,11 +285,29 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
 
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
-  bool hasResponse = false;
+  std::string str;
+  MethodCall(inputString, transport, client,
+             [&str](const char* data, size_t size)
+             {
+               str.append(data, size);
+               return true;
+             });
+
+  return str;
+}
+
+bool CJSONRPC::MethodCall(const std::string& inputString,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          const CJSONVariantStreamWriter::Output& output)
+{
+  CVariant inputroot;
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
 
+  CJSONVariantStreamWriter writer(
+      output, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
   if (CJSONVariantParser::Parse(inputString, inputroot) && !inputroot.isNull())
   {
     if (inputroot.isArray())
@@ -253,38 +315,118 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
       if (inputroot.size() <= 0)
       {
         CLog::Log(LOGERROR, "JSONRPC: Empty batch call");
+        CVariant outputroot;
         BuildResponse(inputroot, InvalidRequest, CVariant(), outputroot);
-        hasResponse = true;
+        return writer.Write(outputroot) && writer.Flush();
       }
-      else
+
+      // the array is only started with the first response, notifications don't get one
+      bool hasResponse = false;
+      const CVariant& requests = inputroot;
+      for (unsigned int index = 0; index < requests.size();)
       {
-        for (CVariant::const_iterator_array itr = inputroot.begin_array();
-             itr != inputroot.end_array(); ++itr)
+        // consecutive read-only calls don't depend on each other, handle them concurrently
+        unsigned int end = index;
+        while (end < requests.size() && IsReadOnlyCall(requests[end]))
+          end++;
+
+        if (end - index > 1)
         {
-          CVariant response;
-          if (HandleMethodCall(*itr, response, transport, client))
+          std::vector<CVariant> responses(end - index);
+          HandleMethodCalls(requests, index, end, responses, transport, client);
+          for (const CVariant& response : responses)
           {
-            outputroot.append(response);
+            if (!hasResponse && !writer.StartArray())
+              return false;
+
             hasResponse = true;
+            if (!writer.Write(response))
+              return false;
           }
+
+          index = end;
+          continue;
         }
+
+        CStreamedResult streamed;
+        CVariant response;
+        if (!HandleMethodCall(requests[index++], response, transport, client))
+          continue;
+
+        if (!hasResponse && !writer.StartArray())
+          return false;
+
+        hasResponse = true;
+        if (!WriteResponse(writer, response, streamed))
+          return false;
       }
+
+      if (hasResponse)
+        return writer.EndArray() && writer.Flush();
+
+      return true;
     }
-    else
-      hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
+
+    CStreamedResult streamed;
+    CVariant outputroot;
+    if (!HandleMethodCall(inputroot, outputroot, transport, client))
+      return true;
+
+    return WriteResponse(writer, outputroot, streamed) && writer.Flush();
   }
-  else
+
+  CLog::Log(LOGERROR, "JSONRPC: Failed to parse '{}'", inputString);
+  CVariant outputroot;
+  BuildResponse(inputroot, ParseError, CVariant(), outputroot);
+  return writer.Write(outputroot) && writer.Flush();
+}
+
+bool CJSONRPC::WriteResponse(CJSONVariantStreamWriter& writer,
+                             const CVariant& response,
+                             const CStreamedResult& streamed)
+{
+  const CVariant& result = response["result"];
+  if (streamed.IsEmpty() || response.isMember("error") || !(result.isObject() || result.isNull()))
+    return writer.Write(response);
+
+  // members are written in the same (sorted) order as CVariant objects are
+  if (!writer.StartObject())
+    return false;
+
+  for (CVariant::const_iterator_map itr = response.begin_map(); itr != response.end_map(); ++itr)
   {
-    CLog::Log(LOGERROR, "JSONRPC: Failed to parse '{}'", inputString);
-    BuildResponse(inputroot, ParseError, CVariant(), outputroot);
-    hasResponse = true;
+    if (itr->first == "result")
+      continue;
+
+    if (!writer.Key(itr->first) || !writer.Write(itr->second))
+      return false;
   }
 
-  std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  if (!writer.Key("result") || !writer.StartObject())
+    return false;
 
-  return str;
+  const auto& members = streamed.GetMembers();
+  auto member = members.cbegin();
+  auto itr = result.begin_map();
+  while (member != members.cend() || itr != result.end_map())
+  {
+    if (member == members.cend() || (itr != result.end_map() && itr->first < member->first))
+    {
+      if (!writer.Key(itr->first) || !writer.Write(itr->second))
+        return false;
+      ++itr;
+    }
+    else
+    {
+      if (itr != result.end_map() && itr->first == member->first)
+        ++itr;
+      if (!writer.Key(member->first) || !member->second(writer))
+        return false;
+      ++member;
+    }
+  }
+
+  return writer.EndObject() && writer.EndObject();
 }
 
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
@@ -304,7 +446,49 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
     CVariant params;
 
     if ((errorCode = CJSONServiceDescription::CheckCall(methodName.c_str(), request["params"], transport, client, isNotification, method, params)) == OK)
-      errorCode = method(methodName, transport, client, params, result);
+    {
+      if (m_resultCache.IsCached(methodName, params))
+      {
+        // results to cache have to be complete, they aren't streamed
+        const std::string key = CResultCache::GetKey(methodName, params);
+        const auto cachedResult = m_resultCache.Get(key);
+        CStreamedResult* streamed = CStreamedResult::GetCurrent();
+        if (cachedResult && streamed && cachedResult->isObject())
+        {
+          // written from the cache, without copying the result
+          result = CVariant(CVariant::VariantTypeObject);
+          for (auto itr = cachedResult->begin_map(); itr != cachedResult->end_map(); ++itr)
+          {
+            const std::string& name = itr->first;
+            streamed->SetMember(name, [cachedResult, name](CJSONVariantStreamWriter& writer)
+                                { return writer.Write((*cachedResult)[name]); });
+          }
+        }
+        else if (cachedResult)
+          result = *cachedResult;
+        else
+        {
+          const uint64_t generation = m_resultCache.GetGeneration();
+          errorCode = method(methodName, transport, client, params, result);
+          if (errorCode == OK)
+            m_resultCache.Put(methodName, key, result, generation);
+        }
+      }
+      else
+      {
+        CStreamedResult* streamed = CStreamedResult::GetCurrent();
+        if (streamed)
+          streamed->SetResult(&result);
+
+        errorCode = method(methodName, transport, client, params, result);
+
+        if (streamed)
+          streamed->SetResult(nullptr);
+
+        if (errorCode == OK && !CJSONServiceDescription::IsReadOnly(methodName))
+          m_resultCache.Invalidate(methodName);
+      }
+    }
     else
       result = params;
   }
@@ -322,6 +506,31 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
   return !isNotification;
 }
 
+void CJSONRPC::HandleMethodCalls(const CVariant& requests,
+                                 unsigned int begin,
+                                 unsigned int end,
+                                 std::vector<CVariant>& responses,
+                                 ITransportLayer* transport,
+                                 IClient* client)
+{
+  // results are built as a whole
+  UTILS::ParallelFor(end - begin, MAX_CONCURRENT_CALLS, [&](size_t i) {
+    HandleMethodCall(requests[static_cast<unsigned int>(begin + i)], responses[i], transport,
+                     client);
+  });
+}
+
+bool CJSONRPC::IsReadOnlyCall(const CVariant& request)
+{
+  // notifications can't read data
+  if (!IsProperJSONRPC(request) || !request.isMember("id"))
+    return false;
+
+  std::string methodName = request["method"].asString();
+  StringUtils::ToLower(methodName);
+  return CJSONServiceDescription::IsReadOnly(methodName);
+}
+
 inline bool CJSONRPC::IsProperJSONRPC(const CVariant& inputroot)
 {
   return inputroot.isMember("jsonrpc") && inputroot["jsonrpc"].isString() && inputroot["jsonrpc"] == CVariant("2.0") && inputroot.isMember("method") && inputroot["method"].isString() && (!inputroot.isMember("params") || inputroot["params"].isArray() || inputroot["params"].isObject());
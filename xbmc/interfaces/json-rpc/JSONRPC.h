@@ -10,16 +10,21 @@
 
 #include "JSONRPCUtils.h"
 #include "JSONServiceDescription.h"
+#include "utils/JSONVariantWriter.h"
 
 #include <iostream>
 #include <map>
 #include <stdio.h>
 #include <string>
+#include <vector>
 
 class CVariant;
 
 namespace JSONRPC
 {
+  class CResultCache;
+  class CStreamedResult;
+
   /*!
    \ingroup jsonrpc
    \brief JSON RPC handler
@@ -53,6 +58,23 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*
+     \brief Handles an incoming JSON-RPC request and streams the response
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param output Receives the JSON-RPC response in chunks
+     \return False if the output failed, true otherwise
+
+     Same as above but long lists in the result of a method are written to
+     the output item by item instead of being held in memory as a whole.
+     Nothing is passed to the output if there is no response.
+     */
+    static bool MethodCall(const std::string& inputString,
+                           ITransportLayer* transport,
+                           IClient* client,
+                           const CJSONVariantStreamWriter::Output& output);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -63,10 +85,21 @@ namespace JSONRPC
 
   private:
     static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
+    static void HandleMethodCalls(const CVariant& requests,
+                                  unsigned int begin,
+                                  unsigned int end,
+                                  std::vector<CVariant>& responses,
+                                  ITransportLayer* transport,
+                                  IClient* client);
+    static bool IsReadOnlyCall(const CVariant& request);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
+    static bool WriteResponse(CJSONVariantStreamWriter& writer,
+                              const CVariant& response,
+                              const CStreamedResult& streamed);
 
     inline static void BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response);
 
     static bool m_initialized;
+    static CResultCache m_resultCache;
   };
 }
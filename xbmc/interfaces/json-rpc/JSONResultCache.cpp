@@ -0,0 +1,288 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONResultCache.h"
+
+#include "ServiceBroker.h"
+#include "media/MediaType.h"
+#include "profiles/ProfileManager.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+using namespace JSONRPC;
+
+namespace
+{
+const std::vector<std::string> MOVIE_TYPES = {MediaTypeMovie, MediaTypeVideoCollection};
+const std::vector<std::string> TVSHOW_TYPES = {MediaTypeTvShow, MediaTypeSeason,
+                                               MediaTypeEpisode};
+const std::vector<std::string> MUSICVIDEO_TYPES = {MediaTypeMusicVideo};
+
+// results larger than this part of the cache aren't cached, they would push out all others
+constexpr size_t MAX_RESULT_PART = 4;
+
+size_t GetSize(const CVariant& value)
+{
+  // estimated, including the overhead of the containers
+  size_t size = sizeof(CVariant);
+  if (value.isString())
+    size += value.size();
+  else if (value.isArray())
+  {
+    for (auto itr = value.begin_array(); itr != value.end_array(); ++itr)
+      size += GetSize(*itr);
+  }
+  else if (value.isObject())
+  {
+    for (auto itr = value.begin_map(); itr != value.end_map(); ++itr)
+      size += sizeof(std::string) + itr->first.size() + GetSize(itr->second);
+  }
+
+  return size;
+}
+} // unnamed namespace
+
+const CResultCache::MethodInfo* CResultCache::GetMethodInfo(const std::string& method)
+{
+  // songs, albums and artists refer to each other, any change affects all music results
+  static const std::map<std::string, MethodInfo> methods = {
+      {"audiolibrary.getalbums", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getartists", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getgenres", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getrecentlyaddedalbums", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getrecentlyaddedsongs", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getrecentlyplayedalbums", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getrecentlyplayedsongs", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getroles", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getsongs", {ANNOUNCEMENT::AudioLibrary, {}}},
+      {"audiolibrary.getsources", {ANNOUNCEMENT::AudioLibrary | ANNOUNCEMENT::Sources, {}}},
+      {"videolibrary.getepisodes", {ANNOUNCEMENT::VideoLibrary, TVSHOW_TYPES}},
+      {"videolibrary.getgenres", {ANNOUNCEMENT::VideoLibrary, {}}},
+      {"videolibrary.getinprogresstvshows", {ANNOUNCEMENT::VideoLibrary, TVSHOW_TYPES}},
+      {"videolibrary.getmovies", {ANNOUNCEMENT::VideoLibrary, MOVIE_TYPES}},
+      {"videolibrary.getmoviesets", {ANNOUNCEMENT::VideoLibrary, MOVIE_TYPES}},
+      {"videolibrary.getmusicvideos", {ANNOUNCEMENT::VideoLibrary, MUSICVIDEO_TYPES}},
+      {"videolibrary.getrecentlyaddedepisodes", {ANNOUNCEMENT::VideoLibrary, TVSHOW_TYPES}},
+      {"videolibrary.getrecentlyaddedmovies", {ANNOUNCEMENT::VideoLibrary, MOVIE_TYPES}},
+      {"videolibrary.getrecentlyaddedmusicvideos", {ANNOUNCEMENT::VideoLibrary, MUSICVIDEO_TYPES}},
+      {"videolibrary.getseasons", {ANNOUNCEMENT::VideoLibrary, TVSHOW_TYPES}},
+      {"videolibrary.gettags", {ANNOUNCEMENT::VideoLibrary, {}}},
+      {"videolibrary.gettvshows", {ANNOUNCEMENT::VideoLibrary, TVSHOW_TYPES}},
+  };
+
+  const auto it = methods.find(method);
+  return it != methods.end() ? &it->second : nullptr;
+}
+
+const std::set<std::string>& CResultCache::GetSettings()
+{
+  // the language changes localised labels
+  static const std::set<std::string> settings = {
+      CSettings::SETTING_LOCALE_LANGUAGE,
+      CSettings::SETTING_FILELISTS_IGNORETHEWHENSORTING,
+      CSettings::SETTING_MUSICLIBRARY_ARTISTSFOLDER,
+      CSettings::SETTING_MUSICLIBRARY_SHOWCOMPILATIONARTISTS,
+      CSettings::SETTING_MUSICLIBRARY_USEARTISTSORTNAME,
+      CSettings::SETTING_MUSICLIBRARY_USEORIGINALDATE,
+      CSettings::SETTING_VIDEOLIBRARY_GROUPMOVIESETS,
+      CSettings::SETTING_VIDEOLIBRARY_GROUPSINGLEITEMSETS,
+      CSettings::SETTING_VIDEOLIBRARY_MOVIESETSFOLDER,
+      CSettings::SETTING_VIDEOLIBRARY_SHOWEMPTYTVSHOWS,
+      CSettings::SETTING_VIDEOLIBRARY_SHOWPERFORMERS,
+  };
+  return settings;
+}
+
+void CResultCache::Configure(size_t maxSize,
+                             const std::vector<std::string>& methods,
+                             int libraries)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_maxSize = maxSize;
+  m_libraries = libraries;
+  m_methods.clear();
+  for (std::string method : methods)
+  {
+    StringUtils::Trim(method);
+    StringUtils::ToLower(method);
+    if (!method.empty())
+      m_methods.emplace_back(std::move(method));
+  }
+
+  m_entries.clear();
+  m_keys.clear();
+  m_size = 0;
+  m_generation++;
+}
+
+void CResultCache::Clear()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_entries.clear();
+  m_keys.clear();
+  m_size = 0;
+  m_generation++;
+}
+
+bool CResultCache::IsCached(const std::string& method, const CVariant& parameters) const
+{
+  const MethodInfo* methodInfo = GetMethodInfo(method);
+  if (!methodInfo)
+    return false;
+
+  if (parameters.isMember("sort") && parameters["sort"].isMember("method") &&
+      parameters["sort"]["method"].asString() == "random")
+    return false;
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return m_maxSize > 0 && (methodInfo->flags & m_libraries) &&
+         std::find(m_methods.cbegin(), m_methods.cend(), method) != m_methods.cend();
+}
+
+std::string CResultCache::GetKey(const std::string& method, const CVariant& parameters)
+{
+  // the libraries depend on the profile
+  std::string key;
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (settingsComponent && settingsComponent->GetProfileManager())
+    key = std::to_string(settingsComponent->GetProfileManager()->GetCurrentProfileId()) + '/';
+
+  // object members are sorted, equal parameters give the same key
+  std::string strParameters;
+  CJSONVariantWriter::Write(parameters, strParameters, true);
+  key += method + ' ' + strParameters;
+
+  return key;
+}
+
+std::shared_ptr<const CVariant> CResultCache::Get(const std::string& key)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  const auto it = m_keys.find(key);
+  if (it == m_keys.end())
+    return {};
+
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->result;
+}
+
+uint64_t CResultCache::GetGeneration() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return m_generation;
+}
+
+void CResultCache::Put(const std::string& method,
+                       const std::string& key,
+                       const CVariant& result,
+                       uint64_t generation)
+{
+  const MethodInfo* methodInfo = GetMethodInfo(method);
+  if (!methodInfo)
+    return;
+
+  // estimate and copy outside of the lock, results may be large
+  const size_t size = GetSize(result) + key.size();
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+    if (size > m_maxSize / MAX_RESULT_PART)
+      return;
+  }
+
+  auto cachedResult = std::make_shared<const CVariant>(result);
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (generation != m_generation || size > m_maxSize / MAX_RESULT_PART ||
+      m_keys.find(key) != m_keys.end())
+    return;
+
+  m_entries.push_front({key, methodInfo, std::move(cachedResult), size});
+  m_keys.emplace(key, m_entries.begin());
+  m_size += size;
+
+  while (m_size > m_maxSize)
+    Remove(std::prev(m_entries.end()));
+}
+
+void CResultCache::Remove(std::list<Entry>::iterator entry)
+{
+  m_size -= entry->size;
+  m_keys.erase(entry->key);
+  m_entries.erase(entry);
+}
+
+void CResultCache::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                            const std::string& sender,
+                            const std::string& message,
+                            const CVariant& data)
+{
+  if (!(flag & (ANNOUNCEMENT::VideoLibrary | ANNOUNCEMENT::AudioLibrary | ANNOUNCEMENT::Sources)))
+    return;
+
+  // these don't change the library
+  if (message == "OnScanStarted" || message == "OnCleanStarted" || message == "OnExport")
+    return;
+
+  // updates and removals of single items tell their type, anything else may affect all items
+  std::string type;
+  if (data.isMember("type"))
+    type = data["type"].asString();
+  else if (data.isMember("item"))
+    type = data["item"]["type"].asString();
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  RemoveAffected(flag, type);
+}
+
+void CResultCache::Invalidate(const std::string& method)
+{
+  // file details of library items are stored in the video library
+  int flags = 0;
+  if (StringUtils::StartsWith(method, "videolibrary.") || method == "files.setfiledetails")
+    flags = ANNOUNCEMENT::VideoLibrary;
+  else if (StringUtils::StartsWith(method, "audiolibrary."))
+    flags = ANNOUNCEMENT::AudioLibrary;
+  else
+    return;
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  RemoveAffected(flags, "");
+}
+
+void CResultCache::RemoveAffected(int flags, const std::string& type)
+{
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    const MethodInfo& method = *it->method;
+    if ((method.flags & flags) &&
+        (type.empty() || method.types.empty() ||
+         std::find(method.types.cbegin(), method.types.cend(), type) != method.types.cend()))
+    {
+      const auto entry = it++;
+      Remove(entry);
+    }
+    else
+      ++it;
+  }
+
+  // results computed while the library changed must not be cached
+  m_generation++;
+}
+
+void CResultCache::OnSettingChanged(const std::shared_ptr<const CSetting>& setting)
+{
+  Clear();
+}
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "interfaces/IAnnouncer.h"
+#include "settings/lib/ISettingCallback.h"
+#include "threads/CriticalSection.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CVariant;
+
+namespace JSONRPC
+{
+  /*!
+   \ingroup jsonrpc
+   \brief Cache of the results of JSON-RPC library methods
+
+   Results are cached by method and (validated) parameters and dropped
+   again when the library announces a change of the kind of items they
+   contain, or when a setting they depend on changes. Only methods known to
+   this cache whose results solely depend on the library and those settings
+   can be cached, of those only the configured ones are. The least recently
+   used results are dropped first.
+   */
+  class CResultCache : public ANNOUNCEMENT::IAnnouncer, public ISettingCallback
+  {
+  public:
+    CResultCache() = default;
+    ~CResultCache() override = default;
+
+    /*!
+     \brief Set up the cache, dropping all cached results
+     \param maxSize Maximum (estimated) size of the results to keep in bytes
+     \param methods Names of the methods to cache, none if empty
+     \param libraries Announcement flags of the libraries whose results may be
+     cached. A library shared with other clients isn't, its changes by other
+     clients aren't announced.
+     */
+    void Configure(size_t maxSize, const std::vector<std::string>& methods, int libraries);
+
+    /*!
+     \brief Get the settings the results of the cacheable methods depend on
+     */
+    static const std::set<std::string>& GetSettings();
+
+    /*!
+     \brief Drop all cached results
+     */
+    void Clear();
+
+    /*!
+     \brief Whether the results of a call are cached. Results sorted randomly
+     never are, each call has to return a new order.
+     \param method Lower case name of the method
+     \param parameters Validated parameters of the call
+     */
+    bool IsCached(const std::string& method, const CVariant& parameters) const;
+
+    /*!
+     \brief Build the key of a result
+     \param method Lower case name of the method
+     \param parameters Validated parameters of the call
+     */
+    static std::string GetKey(const std::string& method, const CVariant& parameters);
+
+    /*!
+     \brief Get a cached result
+     \param key Key of the result
+     \return The result or nullptr if it isn't cached
+     */
+    std::shared_ptr<const CVariant> Get(const std::string& key);
+
+    /*!
+     \brief Get the current generation of the cached results, to be passed
+     to Put() for a result computed afterwards
+     */
+    uint64_t GetGeneration() const;
+
+    /*!
+     \brief Cache a result unless the library changed since it was computed
+     \param method Lower case name of the method
+     \param key Key of the result
+     \param result The result
+     \param generation Generation the result was computed in
+     */
+    void Put(const std::string& method,
+             const std::string& key,
+             const CVariant& result,
+             uint64_t generation);
+
+    /*!
+     \brief Drop the results a call of a method changing a library may affect.
+     Its announcements may be sent asynchronously, a call right after it must
+     not get a stale result meanwhile.
+     \param method Lower case name of a method that isn't read-only
+     */
+    void Invalidate(const std::string& method);
+
+    // implementation of IAnnouncer
+    void Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                  const std::string& sender,
+                  const std::string& message,
+                  const CVariant& data) override;
+
+    // implementation of ISettingCallback
+    void OnSettingChanged(const std::shared_ptr<const CSetting>& setting) override;
+
+  private:
+    struct MethodInfo
+    {
+      int flags; // announcements invalidating the results
+      std::vector<std::string> types; // item types invalidating the results, any if empty
+    };
+
+    struct Entry
+    {
+      std::string key;
+      const MethodInfo* method;
+      std::shared_ptr<const CVariant> result;
+      size_t size;
+    };
+
+    static const MethodInfo* GetMethodInfo(const std::string& method);
+    void Remove(std::list<Entry>::iterator entry);
+    void RemoveAffected(int flags, const std::string& type);
+
+    mutable CCriticalSection m_critSection;
+    size_t m_maxSize = 0;
+    size_t m_size = 0;
+    std::vector<std::string> m_methods;
+    int m_libraries = 0;
+    uint64_t m_generation = 0;
+    std::list<Entry> m_entries; // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_keys;
+  };
+}
@@ -385,6 +385,13 @@ namespace JSONRPC
      */
     static JSONRPC_STATUS CheckCall(const char* method, const CVariant &requestParameters, ITransportLayer *transport, IClient *client, bool notification, MethodCall &methodCall, CVariant &outputParameters);
 
+    /*!
+     \brief Whether the given method only reads data
+     \param method Lower case name of the method
+     \return True if the method only needs the ReadData permission, false otherwise
+     */
+    static bool IsReadOnly(const std::string& method);
+
     static JSONSchemaTypeDefinitionPtr GetType(const std::string &identification);
 
     static void ResolveReferences();
@@ -0,0 +1,38 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONStreamedResult.h"
+
+#include <utility>
+
+using namespace JSONRPC;
+
+namespace
+{
+thread_local CStreamedResult* currentResult = nullptr;
+} // unnamed namespace
+
+CStreamedResult::CStreamedResult() : m_previous(currentResult)
+{
+  currentResult = this;
+}
+
+CStreamedResult::~CStreamedResult()
+{
+  currentResult = m_previous;
+}
+
+CStreamedResult* CStreamedResult::GetCurrent()
+{
+  return currentResult;
+}
+
+void CStreamedResult::SetMember(const std::string& name, MemberWriter writer)
+{
+  m_members[name] = std::move(writer);
+}
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+
+class CJSONVariantStreamWriter;
+class CVariant;
+
+namespace JSONRPC
+{
+  /*!
+   \ingroup jsonrpc
+   \brief Members of the result of a JSON-RPC method which are written
+   directly to the response instead of being built as a CVariant first.
+
+   While a response can be streamed, an instance is set up for the calling
+   thread around the method call. Methods returning long lists register a
+   writer for the list member, which is called when the response is written
+   after the method returned. The writer must not refer to the stack of the
+   method.
+   */
+  class CStreamedResult
+  {
+  public:
+    using MemberWriter = std::function<bool(CJSONVariantStreamWriter& writer)>;
+
+    CStreamedResult();
+    ~CStreamedResult();
+
+    CStreamedResult(const CStreamedResult&) = delete;
+    CStreamedResult& operator=(const CStreamedResult&) = delete;
+
+    /*!
+     \brief Get the streamed result of the method called by this thread
+     \return The streamed result or nullptr if the response can't be streamed
+     */
+    static CStreamedResult* GetCurrent();
+
+    /*!
+     \brief Register the writer of a member of the result object
+     \param name Name of the member
+     \param writer Writes the value of the member
+     */
+    void SetMember(const std::string& name, MemberWriter writer);
+
+    const std::map<std::string, MemberWriter>& GetMembers() const { return m_members; }
+    bool IsEmpty() const { return m_members.empty(); }
+
+    /*!
+     \brief Set the result object of the method while it is called
+     */
+    void SetResult(const CVariant* result) { m_result = result; }
+
+    /*!
+     \brief Whether the given object is the result of the method and not
+     some object nested in it, which can't have streamed members
+     */
+    bool IsResult(const CVariant& result) const { return &result == m_result; }
+
+  private:
+    CStreamedResult* m_previous;
+    const CVariant* m_result = nullptr;
+    std::map<std::string, MemberWriter> m_members;
+  };
+}
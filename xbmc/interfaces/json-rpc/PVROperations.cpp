@@ -150,7 +150,7 @@ JSONRPC_STATUS CPVROperations::GetChannels(const std::string& method,
     channels.Add(std::make_shared<CFileItem>(groupMember));
   }
 
-  HandleFileItemList("channelid", false, "channels", channels, parameterObject, result, true);
+  StreamFileItemList("channelid", false, "channels", channels, parameterObject, result, true);
 
   return OK;
 }
@@ -238,7 +238,7 @@ JSONRPC_STATUS CPVROperations::GetBroadcasts(const std::string& method,
     programFull.Add(std::make_shared<CFileItem>(tag));
   }
 
-  HandleFileItemList("broadcastid", false, "broadcasts", programFull, parameterObject, result,
+  StreamFileItemList("broadcastid", false, "broadcasts", programFull, parameterObject, result,
                      programFull.Size(), true);
 
   return OK;
@@ -440,7 +440,7 @@ JSONRPC_STATUS CPVROperations::GetTimers(const std::string& method,
     timerList.Add(std::make_shared<CFileItem>(timer));
   }
 
-  HandleFileItemList("timerid", false, "timers", timerList, parameterObject, result, true);
+  StreamFileItemList("timerid", false, "timers", timerList, parameterObject, result, true);
 
   return OK;
 }
@@ -591,7 +591,7 @@ JSONRPC_STATUS CPVROperations::GetRecordings(const std::string& method,
     recordingsList.Add(std::make_shared<CFileItem>(recording));
   }
 
-  HandleFileItemList("recordingid", true, "recordings", recordingsList, parameterObject, result,
+  StreamFileItemList("recordingid", true, "recordings", recordingsList, parameterObject, result,
                      true);
 
   return OK;
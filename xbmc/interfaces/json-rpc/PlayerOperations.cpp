@@ -23,6 +23,8 @@
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
 #include "application/ApplicationPowerHandling.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "cores/VideoPlayer/VideoRenderers/RenderTelemetry.h"
 #include "cores/playercorefactory/PlayerCoreFactory.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
@@ -771,6 +773,64 @@ JSONRPC_STATUS CPlayerOperations::GetViewMode(const std::string &method, ITransp
   return OK;
 }
 
+JSONRPC_STATUS CPlayerOperations::GetRenderTelemetry(const std::string& method,
+                                                     ITransportLayer* transport,
+                                                     IClient* client,
+                                                     const CVariant& parameterObject,
+                                                     CVariant& result)
+{
+  if (GetPlayer(parameterObject["playerid"]) != Video)
+    return FailedToExecute;
+
+  const auto& components = CServiceBroker::GetAppComponents();
+  const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+
+  std::vector<RenderFrameTelemetry> frames;
+  if (!appPlayer->GetRenderTelemetry(frames))
+    return FailedToExecute;
+
+  const size_t limit = static_cast<size_t>(parameterObject["limit"].asUnsignedInteger());
+  if (limit > 0 && frames.size() > limit)
+    frames.erase(frames.begin(), frames.end() - limit);
+
+  static const char* dropReasons[] = {"none", "decoder", "output", "late"};
+
+  result["frames"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& frame : frames)
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["pts"] = frame.pts / DVD_TIME_BASE;
+    item["decode"] = frame.decodeTime;
+    item["queue"] = frame.queueTime;
+    item["render"] = frame.renderTime;
+    item["lateness"] = frame.lateness;
+    item["clocksync"] = frame.clockSync;
+    item["missedvsyncs"] = frame.missedVsyncs;
+    item["dropped"] = dropReasons[static_cast<int>(frame.dropReason)];
+    result["frames"].push_back(std::move(item));
+  }
+
+  const CRenderTelemetry::Histograms histograms = CRenderTelemetry::GetHistograms(frames);
+  CVariant& resultHistograms = result["histograms"];
+  resultHistograms["bounds"] = CVariant(CVariant::VariantTypeArray);
+  for (const float bound : CRenderTelemetry::HISTOGRAM_BOUNDS)
+    resultHistograms["bounds"].push_back(bound);
+
+  const auto toVariant = [](const std::vector<unsigned int>& counts)
+  {
+    CVariant variant(CVariant::VariantTypeArray);
+    for (const unsigned int count : counts)
+      variant.push_back(count);
+    return variant;
+  };
+  resultHistograms["decode"] = toVariant(histograms.decode);
+  resultHistograms["queue"] = toVariant(histograms.queue);
+  resultHistograms["render"] = toVariant(histograms.render);
+  resultHistograms["lateness"] = toVariant(histograms.lateness);
+
+  return OK;
+}
+
 JSONRPC_STATUS CPlayerOperations::Rotate(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   switch (GetPlayer(parameterObject["playerid"]))
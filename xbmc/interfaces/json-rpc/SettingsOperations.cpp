@@ -901,5 +901,7 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
     return InvalidParams;
   }
 
+  CSkinSettings::NotifySettingsChanged();
+
   return OK;
 }
@@ -14,10 +14,12 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/JobManager.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <memory>
 #include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -58,6 +60,21 @@ using namespace JSONRPC;
 namespace
 {
 constexpr size_t maxBufferLength = 64 * 1024;
+constexpr size_t maxQueuedRequests = 64;
+
+// transport of the requests handled by jobs, which may outlive the server
+class CWebSocketTransportLayer : public ITransportLayer
+{
+public:
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return false;
+  }
+  bool Download(const char* path, CVariant& result) override { return false; }
+  int GetCapabilities() override { return Response | Announcing; }
+};
+
+CWebSocketTransportLayer webSocketTransportLayer;
 }
 
 CTCPServer *CTCPServer::ServerInstance = NULL;
@@ -160,10 +177,8 @@ void CTCPServer::Process()
               if (websocket != NULL)
               {
                 // Replace the CTCPClient with a CWebSocketClient
-                CWebSocketClient *websocketClient = new CWebSocketClient(websocket, *(m_connections[i]));
-                delete m_connections[i];
-                m_connections.erase(m_connections.begin() + i);
-                m_connections.insert(m_connections.begin() + i, websocketClient);
+                m_connections[i] =
+                    std::make_shared<CWebSocketClient>(websocket, *(m_connections[i]));
               }
             }
 
@@ -179,7 +194,6 @@ void CTCPServer::Process()
           {
             CLog::Log(LOGINFO, "JSONRPC Server: Disconnection detected");
             m_connections[i]->Disconnect();
-            delete m_connections[i];
             m_connections.erase(m_connections.begin() + i);
           }
         }
@@ -190,7 +204,7 @@ void CTCPServer::Process()
         if (FD_ISSET(it, &rfds))
         {
           CLog::Log(LOGDEBUG, "JSONRPC Server: New connection detected");
-          CTCPClient *newconnection = new CTCPClient();
+          auto newconnection = std::make_shared<CTCPClient>();
           newconnection->m_socket =
               accept(it, (sockaddr*)&newconnection->m_cliaddr, &newconnection->m_addrlen);
 
@@ -250,7 +264,7 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
         continue;
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    m_connections[i]->SendAnnouncement(str);
   }
 }
 
@@ -480,10 +494,7 @@ bool CTCPServer::InitializeTCP()
 void CTCPServer::Deinitialize()
 {
   for (unsigned int i = 0; i < m_connections.size(); i++)
-  {
     m_connections[i]->Disconnect();
-    delete m_connections[i];
-  }
 
   m_connections.clear();
 
@@ -541,14 +552,34 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
   return true;
 }
 
-void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
+bool CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
+  // one message at a time, an announcement must not end up in the middle of another one
+  std::unique_lock<CCriticalSection> lock(m_critSection);
   unsigned int sent = 0;
-  do
+  while (sent < size)
   {
-    std::unique_lock<CCriticalSection> lock(m_critSection);
-    sent += send(m_socket, data + sent, size - sent, 0);
-  } while (sent < size);
+    // the response of an asynchronous request may be sent after the disconnection
+    if (m_socket == INVALID_SOCKET)
+      return false;
+    const int result = send(m_socket, data + sent, size - sent, 0);
+    if (result <= 0)
+      return false;
+    sent += result;
+  }
+  return true;
+}
+
+void CTCPServer::CTCPClient::SendAnnouncement(const std::string& announcement)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (m_responding)
+  {
+    m_announcements.emplace_back(announcement);
+    return;
+  }
+
+  Send(announcement.c_str(), announcement.size());
 }
 
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
@@ -614,8 +645,7 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        HandleRequest(host, m_buffer);
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
       }
@@ -623,6 +653,41 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
   }
 }
 
+void CTCPServer::CTCPClient::HandleRequest(CTCPServer* host, const std::string& request)
+{
+  // announcements are held back from the first part of the response on, without keeping
+  // the announcing thread waiting while the rest of the response is generated
+  bool responding = false;
+  CJSONRPC::MethodCall(request, host, this,
+                       [this, &responding](const char* data, size_t size)
+                       {
+                         if (!responding)
+                         {
+                           BeginResponse();
+                           responding = true;
+                         }
+                         return Send(data, static_cast<unsigned int>(size));
+                       });
+
+  if (responding)
+    EndResponse();
+}
+
+void CTCPServer::CTCPClient::BeginResponse()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_responding = true;
+}
+
+void CTCPServer::CTCPClient::EndResponse()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_responding = false;
+  for (const std::string& announcement : m_announcements)
+    Send(announcement.c_str(), announcement.size());
+  m_announcements.clear();
+}
+
 void CTCPServer::CTCPClient::Disconnect()
 {
   if (m_socket > 0)
@@ -684,19 +749,41 @@ CTCPServer::CWebSocketClient& CTCPServer::CWebSocketClient::operator=(const CWeb
   return *this;
 }
 
-void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
+bool CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
 {
+  // responses are sent from a job, keep their frames apart from those of announcements
+  std::unique_lock<CCriticalSection> lock(m_critSection);
   const CWebSocketMessage *msg = m_websocket->Send(WebSocketTextFrame, data, size);
   if (msg == NULL || !msg->IsComplete())
-    return;
+    return false;
 
   std::vector<const CWebSocketFrame *> frames = msg->GetFrames();
   for (unsigned int index = 0; index < frames.size(); index++)
-    CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
+  {
+    if (!CTCPClient::Send(frames.at(index)->GetFrameData(),
+                          (unsigned int)frames.at(index)->GetFrameLength()))
+      return false;
+  }
+  return true;
+}
+
+bool CTCPServer::CWebSocketClient::SendFrame(WebSocketFrameOpcode opcode,
+                                              const std::string& data,
+                                              bool final)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  const std::unique_ptr<const CWebSocketFrame> frame(
+      m_websocket->Fragment(opcode, data.c_str(), static_cast<uint32_t>(data.size()), final));
+  if (frame == nullptr)
+    return false;
+
+  return CTCPClient::Send(frame->GetFrameData(), static_cast<unsigned int>(frame->GetFrameLength()));
 }
 
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
+  // the job handling the requests sends from another thread
+  std::unique_lock<CCriticalSection> lock(m_critSection);
   bool send;
   const CWebSocketMessage *msg = NULL;
 
@@ -740,8 +827,83 @@ void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buff
     Disconnect();
 }
 
+void CTCPServer::CWebSocketClient::HandleRequest(CTCPServer* host, const std::string& request)
+{
+  std::unique_lock<CCriticalSection> lock(m_requestsSection);
+  if (m_requests.size() >= maxQueuedRequests)
+  {
+    lock.unlock();
+    CLog::Log(LOGINFO, "WebSocket: client request queue size {} exceeded", maxQueuedRequests);
+    return Disconnect();
+  }
+
+  m_requests.emplace_back(request);
+  if (m_handlingRequests)
+    return;
+
+  // one job per client handles its requests in order, while a long-running one is handled
+  // the server keeps serving the other clients and the announcements
+  m_handlingRequests = true;
+  auto client = std::static_pointer_cast<CWebSocketClient>(shared_from_this());
+  CServiceBroker::GetJobManager()->Submit([client]() { client->HandleRequests(); },
+                                          CJob::PRIORITY_HIGH);
+}
+
+void CTCPServer::CWebSocketClient::HandleRequests()
+{
+  while (true)
+  {
+    std::string request;
+    {
+      std::unique_lock<CCriticalSection> lock(m_requestsSection);
+      if (m_requests.empty())
+      {
+        m_handlingRequests = false;
+        return;
+      }
+
+      request = std::move(m_requests.front());
+      m_requests.pop_front();
+    }
+
+    // the parts of the response are sent as the frames of a fragmented message while it's
+    // generated, the last one is held back to end the message with it
+    std::string pending;
+    bool fragmented = false;
+    bool sent = true;
+    BeginResponse();
+    CJSONRPC::MethodCall(request, &webSocketTransportLayer, this,
+                         [this, &pending, &fragmented, &sent](const char* data, size_t size)
+                         {
+                           if (!pending.empty())
+                           {
+                             sent = SendFrame(fragmented ? WebSocketContinuationFrame
+                                                         : WebSocketTextFrame,
+                                              pending, false);
+                             if (!sent)
+                               return false;
+
+                             fragmented = true;
+                           }
+                           pending.assign(data, size);
+                           return true;
+                         });
+
+    if (sent && (fragmented || !pending.empty()))
+      SendFrame(fragmented ? WebSocketContinuationFrame : WebSocketTextFrame, pending, true);
+    EndResponse();
+  }
+}
+
 void CTCPServer::CWebSocketClient::Disconnect()
 {
+  {
+    // the request being handled still completes, its response isn't sent
+    std::unique_lock<CCriticalSection> lock(m_requestsSection);
+    m_requests.clear();
+  }
+
+  std::unique_lock<CCriticalSection> lock(m_critSection);
   if (m_socket > 0)
   {
     if (m_websocket->GetState() != WebSocketStateClosed && m_websocket->GetState() != WebSocketStateNotConnected)
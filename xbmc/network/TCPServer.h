@@ -15,6 +15,9 @@
 #include "threads/Thread.h"
 #include "websocket/WebSocket.h"
 
+#include <deque>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <sys/socket.h>
@@ -50,7 +53,7 @@ namespace JSONRPC
     bool InitializeTCP();
     void Deinitialize();
 
-    class CTCPClient : public IClient
+    class CTCPClient : public IClient, public std::enable_shared_from_this<CTCPClient>
     {
     public:
       CTCPClient();
@@ -64,8 +67,11 @@ namespace JSONRPC
       int GetAnnouncementFlags() override;
       bool SetAnnouncementFlags(int flags) override;
 
-      virtual void Send(const char *data, unsigned int size);
+      virtual bool Send(const char *data, unsigned int size);
+      //Held back while a streamed response is being sent
+      void SendAnnouncement(const std::string& announcement);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
+      virtual void HandleRequest(CTCPServer* host, const std::string& request);
       virtual void Disconnect();
 
       virtual bool IsNew() const { return m_new; }
@@ -78,12 +84,18 @@ namespace JSONRPC
 
     protected:
       void Copy(const CTCPClient& client);
+      //Announcements are held back from BeginResponse() until EndResponse()
+      void BeginResponse();
+      void EndResponse();
     private:
       bool m_new;
       int m_announcementflags;
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
       std::string m_buffer;
+      //Not copied, only set while a request is handled
+      bool m_responding = false;
+      std::vector<std::string> m_announcements;
     };
 
     class CWebSocketClient : public CTCPClient
@@ -95,19 +107,28 @@ namespace JSONRPC
       CWebSocketClient& operator=(const CWebSocketClient& client);
       ~CWebSocketClient() override;
 
-      void Send(const char *data, unsigned int size) override;
+      bool Send(const char *data, unsigned int size) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
+      //Handled by a job, the response is streamed as a fragmented message
+      void HandleRequest(CTCPServer* host, const std::string& request) override;
       void Disconnect() override;
 
       bool IsNew() const override { return m_websocket == NULL; }
       bool Closing() const override { return m_websocket != NULL && m_websocket->GetState() == WebSocketStateClosed; }
 
     private:
+      void HandleRequests();
+      bool SendFrame(WebSocketFrameOpcode opcode, const std::string& data, bool final);
+
       CWebSocket *m_websocket;
       std::string m_buffer;
+      //Not copied, requests are only queued after the upgrade to a websocket
+      CCriticalSection m_requestsSection;
+      std::deque<std::string> m_requests;
+      bool m_handlingRequests = false;
     };
 
-    std::vector<CTCPClient*> m_connections;
+    std::vector<std::shared_ptr<CTCPClient>> m_connections;
     std::vector<SOCKET> m_servers;
     int m_port;
     bool m_nonlocal;
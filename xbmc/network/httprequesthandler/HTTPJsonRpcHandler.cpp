@@ -18,8 +18,25 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <utility>
+
 #define MAX_HTTP_POST_SIZE 65536
 
+namespace
+{
+// most response data held back while libmicrohttpd sends the data before
+constexpr size_t MAX_STREAM_BUFFER_SIZE = 256 * 1024;
+} // unnamed namespace
+
+CHTTPJsonRpcHandler::~CHTTPJsonRpcHandler()
+{
+  // let the method call writing the response give up and wait for it
+  m_responseStream.Close();
+  if (m_responseWriter.valid())
+    m_responseWriter.wait();
+}
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -72,10 +89,30 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    // the response is written while libmicrohttpd sends it, long lists in the result are never
+    // held in memory as a whole
+    m_responseWriter = std::async(
+        std::launch::async,
+        [this, method = m_request.method, request = std::move(m_requestData), jsonpCallback]()
+        {
+          CHTTPClient client(method);
+          const auto output = [this](const char* data, size_t size)
+          { return m_responseStream.Write(data, size); };
+
+          const std::string jsonpStart = jsonpCallback + "(";
+          const bool success =
+              (jsonpCallback.empty() || output(jsonpStart.c_str(), jsonpStart.size())) &&
+              JSONRPC::CJSONRPC::MethodCall(request, &m_transportLayer, &client, output) &&
+              (jsonpCallback.empty() || output(");", 2));
+          m_responseStream.End(success);
+        });
+    m_requestData.clear();
+
+    m_response.type = HTTPStreamDownload;
+    m_response.status = MHD_HTTP_OK;
+    m_response.contentType = "application/json";
 
-    if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+    return MHD_YES;
   }
   else if (jsonpCallback.empty())
   {
@@ -118,6 +155,11 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseData(char* buffer, size_t size)
+{
+  return m_responseStream.Read(buffer, size);
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
@@ -134,6 +176,56 @@ bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
   return true;
 }
 
+bool CHTTPJsonRpcHandler::CResponseStream::Write(const char* data, size_t size)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_changed.wait(lock, [this]()
+                 { return m_closed || m_data.size() - m_readPosition < MAX_STREAM_BUFFER_SIZE; });
+  if (m_closed)
+    return false;
+
+  // drop what was read before instead of growing the buffer
+  if (m_readPosition > 0)
+  {
+    m_data.erase(0, m_readPosition);
+    m_readPosition = 0;
+  }
+
+  m_data.append(data, size);
+  m_changed.notify_all();
+  return true;
+}
+
+ssize_t CHTTPJsonRpcHandler::CResponseStream::Read(char* buffer, size_t size)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_changed.wait(lock, [this]() { return m_closed || m_ended || m_readPosition < m_data.size(); });
+
+  const size_t read = std::min(size, m_data.size() - m_readPosition);
+  if (read == 0)
+    return m_ended && !m_failed ? 0 : -1;
+
+  m_data.copy(buffer, read, m_readPosition);
+  m_readPosition += read;
+  m_changed.notify_all();
+  return static_cast<ssize_t>(read);
+}
+
+void CHTTPJsonRpcHandler::CResponseStream::End(bool success)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_ended = true;
+  m_failed = !success;
+  m_changed.notify_all();
+}
+
+void CHTTPJsonRpcHandler::CResponseStream::Close()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_closed = true;
+  m_changed.notify_all();
+}
+
 bool CHTTPJsonRpcHandler::CHTTPTransportLayer::PrepareDownload(const char *path, CVariant &details, std::string &protocol)
 {
   if (!CFileUtils::Exists(path))
@@ -12,13 +12,16 @@
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
 
+#include <condition_variable>
+#include <future>
+#include <mutex>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
 {
 public:
   CHTTPJsonRpcHandler() = default;
-  ~CHTTPJsonRpcHandler() override = default;
+  ~CHTTPJsonRpcHandler() override;
 
   // implementations of IHTTPRequestHandler
   IHTTPRequestHandler* Create(const HTTPRequest &request) const override { return new CHTTPJsonRpcHandler(request); }
@@ -27,6 +30,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseData(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -42,6 +46,34 @@ private:
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
 
+  /*!
+   * \brief Bounded buffer between the thread writing the response of a method call and
+   * libmicrohttpd sending it.
+   */
+  class CResponseStream
+  {
+  public:
+    //! Waits while the buffer is full, false once the reader is gone
+    bool Write(const char* data, size_t size);
+    //! Waits while the buffer is empty, 0 at the end of the response, -1 on error
+    ssize_t Read(char* buffer, size_t size);
+    //! Called by the writer when the response is complete or failed
+    void End(bool success);
+    //! Called when the response won't be read anymore
+    void Close();
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::string m_data;
+    size_t m_readPosition = 0;
+    bool m_ended = false;
+    bool m_failed = false;
+    bool m_closed = false;
+  };
+  CResponseStream m_responseStream;
+  std::future<void> m_responseWriter;
+
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
   public:
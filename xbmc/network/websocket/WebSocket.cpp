@@ -432,3 +432,16 @@ const CWebSocketMessage* CWebSocket::Send(WebSocketFrameOpcode opcode, const cha
 
   return NULL;
 }
+
+const CWebSocketFrame* CWebSocket::Fragment(WebSocketFrameOpcode opcode, const char* data, uint32_t length, bool final)
+{
+  CWebSocketFrame *frame = GetFrame(opcode, data, length, final);
+  if (frame == NULL || !frame->IsValid())
+  {
+    CLog::Log(LOGINFO, "WebSocket: Trying to send an invalid frame");
+    delete frame;
+    return NULL;
+  }
+
+  return frame;
+}
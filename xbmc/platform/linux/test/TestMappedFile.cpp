@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "platform/posix/utils/MappedFile.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace KODI::UTILS::POSIX;
+
+class TestMappedFile : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/kodi-mappedfile-XXXXXX";
+    m_fd = mkstemp(path);
+    ASSERT_GE(m_fd, 0);
+    m_path = path;
+  }
+
+  void TearDown() override
+  {
+    close(m_fd);
+    unlink(m_path.c_str());
+  }
+
+  void Append(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+      data[i] = Pattern(m_written + i);
+    ASSERT_EQ(static_cast<ssize_t>(size), write(m_fd, data.data(), size));
+    m_written += size;
+  }
+
+  static uint8_t Pattern(size_t pos) { return static_cast<uint8_t>(pos * 7 + pos / 251); }
+
+  int m_fd{-1};
+  std::string m_path;
+  size_t m_written{0};
+};
+
+TEST_F(TestMappedFile, ReadAcrossWindows)
+{
+  Append(CMappedFile::WINDOW_SIZE + 12345);
+
+  CMappedFile file;
+  ASSERT_TRUE(file.Open(m_path));
+  EXPECT_EQ(static_cast<int64_t>(m_written), file.GetLength());
+
+  std::vector<uint8_t> buf(1000000);
+  size_t pos = 0;
+  int read;
+  while ((read = file.Read(buf.data(), static_cast<int>(buf.size()))) > 0)
+  {
+    for (int i = 0; i < read; i++)
+      ASSERT_EQ(Pattern(pos + i), buf[i]) << "at " << pos + i;
+    pos += read;
+  }
+  EXPECT_EQ(m_written, pos);
+}
+
+TEST_F(TestMappedFile, SeekAndReadDirect)
+{
+  Append(CMappedFile::WINDOW_SIZE + 12345);
+
+  CMappedFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  // map the first window, the data handed out directly ends with it
+  size_t size = 1;
+  ASSERT_NE(nullptr, file.ReadDirect(size));
+
+  const int64_t offset = CMappedFile::WINDOW_SIZE - 100;
+  EXPECT_EQ(offset, file.Seek(offset, SEEK_SET));
+  size = 1000;
+  const uint8_t* data = file.ReadDirect(size);
+  ASSERT_NE(nullptr, data);
+  EXPECT_EQ(100u, size);
+  EXPECT_EQ(Pattern(offset), data[0]);
+  EXPECT_EQ(CMappedFile::WINDOW_SIZE, file.GetPosition());
+
+  size = 1000;
+  data = file.ReadDirect(size);
+  ASSERT_NE(nullptr, data);
+  EXPECT_EQ(1000u, size);
+  EXPECT_EQ(Pattern(CMappedFile::WINDOW_SIZE), data[0]);
+
+  EXPECT_EQ(static_cast<int64_t>(m_written) - 10, file.Seek(-10, SEEK_END));
+  uint8_t buf[100];
+  EXPECT_EQ(10, file.Read(buf, sizeof(buf)));
+  EXPECT_EQ(0, file.Read(buf, sizeof(buf)));
+}
+
+TEST_F(TestMappedFile, GrowingFile)
+{
+  Append(5000);
+
+  CMappedFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  std::vector<uint8_t> buf(10000);
+  EXPECT_EQ(5000, file.Read(buf.data(), static_cast<int>(buf.size())));
+  EXPECT_EQ(0, file.Read(buf.data(), static_cast<int>(buf.size())));
+
+  Append(3000);
+  EXPECT_EQ(3000, file.Read(buf.data(), static_cast<int>(buf.size())));
+  EXPECT_EQ(Pattern(5000), buf[0]);
+  EXPECT_EQ(8000, file.GetLength());
+}
+
+TEST_F(TestMappedFile, TruncatedFile)
+{
+  Append(3 * 65536);
+
+  CMappedFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  std::vector<uint8_t> buf(65536);
+  EXPECT_EQ(65536, file.Read(buf.data(), static_cast<int>(buf.size())));
+
+  // the mapped pages beyond the end of the file are gone, reading them raises SIGBUS
+  ASSERT_EQ(0, ftruncate(m_fd, 65536));
+  EXPECT_EQ(-1, file.Read(buf.data(), static_cast<int>(buf.size())));
+  EXPECT_EQ(65536, file.GetPosition());
+
+  // the fault is handled again
+  EXPECT_EQ(-1, file.Read(buf.data(), static_cast<int>(buf.size())));
+}
@@ -0,0 +1,342 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MappedFile.h"
+
+#include "Mmap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+#include <sys/sysmacros.h>
+#include <sys/vfs.h>
+#endif
+
+using namespace KODI::UTILS::POSIX;
+
+namespace
+{
+// the part of a mapping this thread copies from, a SIGBUS within it fails the copy
+thread_local const uint8_t* copyStart = nullptr;
+thread_local std::size_t copySize = 0;
+thread_local sigjmp_buf copyJump;
+
+struct sigaction previousSigBusAction;
+std::once_flag sigBusHandlerInstalled;
+
+void SigBusHandler([[maybe_unused]] int signal, siginfo_t* info, [[maybe_unused]] void* context)
+{
+  const uint8_t* address = static_cast<const uint8_t*>(info->si_addr);
+  if (copyStart && address >= copyStart && address < copyStart + copySize)
+    siglongjmp(copyJump, 1);
+
+  // not a copy from a mapping, pass it on to the previous handler and stay installed
+  if (previousSigBusAction.sa_flags & SA_SIGINFO)
+  {
+    previousSigBusAction.sa_sigaction(signal, info, context);
+    return;
+  }
+
+  if (previousSigBusAction.sa_handler == SIG_IGN)
+    return;
+
+  if (previousSigBusAction.sa_handler == SIG_DFL)
+  {
+    // the faulting access is repeated on return and terminates the process
+    struct sigaction action = {};
+    action.sa_handler = SIG_DFL;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGBUS, &action, nullptr);
+    return;
+  }
+
+  previousSigBusAction.sa_handler(signal);
+}
+
+void InstallSigBusHandler()
+{
+  struct sigaction action = {};
+  action.sa_sigaction = SigBusHandler;
+  // the handler jumps out, SIGBUS must not stay blocked
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGBUS, &action, &previousSigBusAction);
+}
+
+/*!
+ * Copy from a mapping. Accessing a page beyond the end of a truncated file, of a disk
+ * that was removed or that fails to read raises SIGBUS, which fails the copy instead.
+ */
+bool CopyFromMapping(uint8_t* dest, const uint8_t* src, std::size_t size)
+{
+  std::call_once(sigBusHandlerInstalled, InstallSigBusHandler);
+
+  if (sigsetjmp(copyJump, 0) != 0)
+  {
+    copyStart = nullptr;
+    return false;
+  }
+
+  copyStart = src;
+  copySize = size;
+  // the handler has to see the range while copying
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  std::memcpy(dest, src, size);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  copyStart = nullptr;
+  return true;
+}
+
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+bool IsRemovableDevice(dev_t device)
+{
+  std::error_code ec;
+  const std::filesystem::path path = std::filesystem::canonical(
+      "/sys/dev/block/" + std::to_string(major(device)) + ":" + std::to_string(minor(device)),
+      ec);
+  if (ec)
+    return false;
+
+  // USB disks often don't claim to be removable
+  if (path.string().find("/usb") != std::string::npos)
+    return true;
+
+  // partitions don't have the attribute, their disk has
+  for (const auto& dir : {path, path.parent_path()})
+  {
+    std::ifstream removable(dir / "removable");
+    int value = 0;
+    if (removable >> value)
+      return value != 0;
+  }
+  return false;
+}
+#endif
+
+/*!
+ * Whether the file is on a local filesystem of a fixed disk. Network filesystems may go
+ * stale and removable disks may be unplugged, their mapped reads would fault.
+ */
+bool IsFixedLocalFile(int fd, const struct stat& st)
+{
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+  constexpr unsigned long NFS_MAGIC = 0x6969;
+  constexpr unsigned long SMB_MAGIC = 0x517B;
+  constexpr unsigned long CIFS_MAGIC = 0xFF534D42;
+  constexpr unsigned long SMB2_MAGIC = 0xFE534D42;
+  constexpr unsigned long FUSE_MAGIC = 0x65735546;
+  constexpr unsigned long V9FS_MAGIC = 0x01021997;
+  constexpr unsigned long CEPH_MAGIC = 0x00C36400;
+
+  struct statfs fs;
+  if (fstatfs(fd, &fs) != 0)
+    return false;
+
+  switch (static_cast<unsigned long>(fs.f_type) & 0xFFFFFFFF)
+  {
+    case NFS_MAGIC:
+    case SMB_MAGIC:
+    case CIFS_MAGIC:
+    case SMB2_MAGIC:
+    case FUSE_MAGIC:
+    case V9FS_MAGIC:
+    case CEPH_MAGIC:
+      return false;
+    default:
+      return !IsRemovableDevice(st.st_dev);
+  }
+#else
+  // no way to tell removable disks apart
+  return false;
+#endif
+}
+} // unnamed namespace
+
+CMappedFile::CMappedFile() = default;
+
+CMappedFile::~CMappedFile()
+{
+  Close();
+}
+
+bool CMappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  m_fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (m_fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(m_fd, &st) != 0 || !S_ISREG(st.st_mode) || !IsFixedLocalFile(m_fd, st))
+  {
+    Close();
+    return false;
+  }
+
+  m_size = st.st_size;
+  m_pos = 0;
+  m_pageSize = std::max<long>(sysconf(_SC_PAGESIZE), 1);
+  return true;
+}
+
+void CMappedFile::Close()
+{
+  m_window.reset();
+  m_windowStart = 0;
+  m_windowEnd = 0;
+  m_adviseEnd = 0;
+
+  if (m_fd >= 0)
+  {
+    close(m_fd);
+    m_fd = -1;
+  }
+  m_size = 0;
+  m_pos = 0;
+}
+
+const uint8_t* CMappedFile::ReadDirect(std::size_t& size)
+{
+  // a file being recorded grows while it is played
+  if (m_pos >= m_size)
+    GetLength();
+
+  if (m_fd < 0 || m_pos >= m_size || size == 0)
+  {
+    size = 0;
+    return nullptr;
+  }
+
+  if ((m_pos < m_windowStart || m_pos >= m_windowEnd) && !MapWindow(m_pos))
+  {
+    size = 0;
+    return nullptr;
+  }
+
+  size = static_cast<std::size_t>(
+      std::min(static_cast<int64_t>(size), m_windowEnd - m_pos));
+  const uint8_t* data = static_cast<const uint8_t*>(m_window->Data()) + (m_pos - m_windowStart);
+  m_pos += size;
+
+  AdviseReadAhead();
+  return data;
+}
+
+int CMappedFile::Read(uint8_t* buf, int size)
+{
+  const int64_t start = m_pos;
+  int done = 0;
+  while (done < size)
+  {
+    std::size_t chunk = size - done;
+    const uint8_t* data = ReadDirect(chunk);
+    if (!data)
+      break;
+
+    if (!CopyFromMapping(buf + done, data, chunk))
+    {
+      m_pos = start;
+      return -1;
+    }
+    done += static_cast<int>(chunk);
+  }
+  return done;
+}
+
+int64_t CMappedFile::Seek(int64_t offset, int whence)
+{
+  if (m_fd < 0)
+    return -1;
+
+  int64_t pos;
+  switch (whence)
+  {
+    case SEEK_SET:
+      pos = offset;
+      break;
+    case SEEK_CUR:
+      pos = m_pos + offset;
+      break;
+    case SEEK_END:
+      pos = GetLength() + offset;
+      break;
+    default:
+      return -1;
+  }
+
+  if (pos < 0)
+    return -1;
+
+  // start the read ahead over at the new position
+  m_pos = pos;
+  m_adviseEnd = pos;
+  return m_pos;
+}
+
+int64_t CMappedFile::GetLength()
+{
+  struct stat st;
+  if (m_fd >= 0 && fstat(m_fd, &st) == 0)
+    m_size = std::max<int64_t>(m_size, st.st_size);
+  return m_size;
+}
+
+bool CMappedFile::MapWindow(int64_t pos)
+{
+  m_window.reset();
+  m_windowStart = pos - pos % m_pageSize;
+  m_windowEnd = std::min(m_windowStart + WINDOW_SIZE, m_size);
+
+  try
+  {
+    m_window = std::make_unique<CMmap>(nullptr, m_windowEnd - m_windowStart, PROT_READ,
+                                       MAP_SHARED, m_fd, m_windowStart);
+  }
+  catch (const std::system_error&)
+  {
+    m_windowStart = 0;
+    m_windowEnd = 0;
+    return false;
+  }
+
+  madvise(m_window->Data(), m_window->Size(), MADV_SEQUENTIAL);
+  m_adviseEnd = pos;
+  return true;
+}
+
+void CMappedFile::AdviseReadAhead()
+{
+  // advise in steps of half the read ahead, not on every read
+  if (m_adviseEnd - m_pos >= READAHEAD_SIZE / 2 || m_adviseEnd >= m_windowEnd)
+    return;
+
+  int64_t start = std::max(m_adviseEnd, m_pos);
+  start -= start % m_pageSize;
+  const int64_t end = std::min(m_pos + READAHEAD_SIZE, m_windowEnd);
+  if (end <= start)
+    return;
+
+  uint8_t* data = static_cast<uint8_t*>(m_window->Data()) + (start - m_windowStart);
+  madvise(data, end - start, MADV_WILLNEED);
+  m_adviseEnd = end;
+}
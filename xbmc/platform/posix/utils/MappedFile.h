@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace KODI
+{
+namespace UTILS
+{
+namespace POSIX
+{
+
+class CMmap;
+
+/**
+ * Read-only access to a local file through a memory mapping.
+ *
+ * Reads are served from the page cache without a read() call and without the copy
+ * into an intermediate buffer. The file is mapped one window at a time to keep the
+ * address space use low on 32 bit systems. The kernel is asked to read ahead of the
+ * read position with MADV_WILLNEED, so a sequential reader rarely blocks on a page
+ * fault.
+ *
+ * Only regular files on fixed local disks can be opened. Network filesystems and
+ * removable disks are refused, their pages may become inaccessible at any time.
+ *
+ * The file may grow while it is read, e.g. a recording in progress. If it is truncated
+ * or the disk fails, accessing a mapped page raises SIGBUS. Read() turns that into an
+ * error, data handed out by ReadDirect() is not protected.
+ */
+class CMappedFile
+{
+public:
+  //! part of the file mapped at a time
+  static constexpr int64_t WINDOW_SIZE = 32 * 1024 * 1024;
+  //! how far ahead of the read position the kernel is asked to read
+  static constexpr int64_t READAHEAD_SIZE = 4 * 1024 * 1024;
+
+  CMappedFile();
+  ~CMappedFile();
+
+  bool Open(const std::string& filename);
+  void Close();
+  bool IsOpen() const { return m_fd >= 0; }
+
+  /**
+   * Get the data at the read position without copying it and advance the position
+   *
+   * @param[in,out] size bytes wanted, set to the bytes available, which may be less
+   *                when the end of the mapped window is reached
+   * @return pointer valid until the next call, nullptr at the end of the file
+   */
+  const uint8_t* ReadDirect(std::size_t& size);
+
+  /**
+   * Copy data at the read position, crossing windows as needed
+   *
+   * @return bytes read, 0 at the end of the file, -1 if the mapped data became
+   *         inaccessible, the read position is unchanged then
+   */
+  int Read(uint8_t* buf, int size);
+
+  int64_t Seek(int64_t offset, int whence);
+  int64_t GetPosition() const { return m_pos; }
+  int64_t GetLength();
+
+private:
+  CMappedFile(CMappedFile const& other) = delete;
+  CMappedFile& operator=(CMappedFile const& other) = delete;
+
+  bool MapWindow(int64_t pos);
+  void AdviseReadAhead();
+
+  int m_fd{-1};
+  int64_t m_size{0};
+  int64_t m_pos{0};
+  int64_t m_pageSize{4096};
+
+  std::unique_ptr<CMmap> m_window;
+  int64_t m_windowStart{0};
+  int64_t m_windowEnd{0};
+  int64_t m_adviseEnd{0}; ///< end of the range last passed to MADV_WILLNEED
+};
+
+}
+}
+}
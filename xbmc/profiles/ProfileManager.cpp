@@ -530,6 +530,8 @@ void CProfileManager::CreateProfileFolders()
   CDirectory::Create(GetThumbnailsFolder());
   CDirectory::Create(GetVideoThumbFolder());
   CDirectory::Create(GetBookmarksThumbFolder());
+  CDirectory::Create(GetKeyframesFolder());
+  CDirectory::Create(GetStreamDetailsFolder());
   CDirectory::Create(GetSavestatesFolder());
   for (size_t hex = 0; hex < 16; hex++)
     CDirectory::Create(
@@ -685,6 +687,16 @@ std::string CProfileManager::GetBookmarksThumbFolder() const
   return URIUtils::AddFileToFolder(GetVideoThumbFolder(), "Bookmarks");
 }
 
+std::string CProfileManager::GetKeyframesFolder() const
+{
+  return URIUtils::AddFileToFolder(GetVideoThumbFolder(), "Keyframes");
+}
+
+std::string CProfileManager::GetStreamDetailsFolder() const
+{
+  return URIUtils::AddFileToFolder(GetVideoThumbFolder(), "StreamDetails");
+}
+
 std::string CProfileManager::GetLibraryFolder() const
 {
   if (GetCurrentProfile().hasDatabases())
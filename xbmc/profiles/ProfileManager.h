@@ -178,6 +178,8 @@ public:
   std::string GetThumbnailsFolder() const;
   std::string GetVideoThumbFolder() const;
   std::string GetBookmarksThumbFolder() const;
+  std::string GetKeyframesFolder() const;
+  std::string GetStreamDetailsFolder() const;
   std::string GetLibraryFolder() const;
   std::string GetSavestatesFolder() const;
   std::string GetSettingsFile() const;
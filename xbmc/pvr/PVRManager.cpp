@@ -46,6 +46,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -713,6 +714,21 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
   if (newClients.empty())
     return !m_knownClients.empty();
 
+  CStopWatch timer;
+  timer.StartZero();
+
+  // Recordings don't depend on the other data, load them while channels and timers are loaded.
+  // The clients publish each kind of data as soon as it is complete.
+  float recordingsMs = 0.0f;
+  std::future<bool> recordingsLoaded =
+      std::async(std::launch::async, [this, &newClients, &recordingsMs]() {
+        CStopWatch recordingsTimer;
+        recordingsTimer.StartZero();
+        const bool bLoaded = m_recordings->Update(newClients);
+        recordingsMs = recordingsTimer.GetElapsedMilliseconds();
+        return bLoaded;
+      });
+
   // Load all channels and groups
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19236), 0); // Loading channels and groups
@@ -728,6 +744,8 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
   if (stateToCheck != GetState())
     return false;
 
+  const float providersMs = timer.GetElapsedMilliseconds();
+
   if (!m_channelGroups->Update(newClients))
   {
     CLog::LogF(LOGERROR, "Failed to load PVR channels / groups.");
@@ -736,10 +754,13 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
     return false;
   }
 
+  const float channelsMs = timer.GetElapsedMilliseconds() - providersMs;
+
   // Load all timers
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19237), 50); // Loading timers
 
+  // timers refer to channels, they have to be loaded first
   if (!m_timers->Update(newClients))
   {
     CLog::LogF(LOGERROR, "Failed to load PVR timers.");
@@ -748,11 +769,13 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
     return false;
   }
 
-  // Load all recordings
+  const float timersMs = timer.GetElapsedMilliseconds() - providersMs - channelsMs;
+
+  // Wait for all recordings
   if (progressHandler)
     progressHandler->UpdateProgress(g_localizeStrings.Get(19238), 75); // Loading recordings
 
-  if (!m_recordings->Update(newClients))
+  if (!recordingsLoaded.get())
   {
     CLog::LogF(LOGERROR, "Failed to load PVR recordings.");
     m_knownClients.clear(); // start over
@@ -760,6 +783,12 @@ bool CPVRManager::UpdateComponents(ManagerState stateToCheck,
     return false;
   }
 
+  CLog::Log(LOGINFO,
+            "PVR Manager: Loaded data of {} new client(s) in {:.0f} ms (providers {:.0f} ms, "
+            "channels and groups {:.0f} ms, timers {:.0f} ms, recordings {:.0f} ms)",
+            newClients.size(), timer.GetElapsedMilliseconds(), providersMs, channelsMs, timersMs,
+            recordingsMs);
+
   // reinit playbackstate as new client may provide new last opened group / last played channel
   m_playbackState->ReInit();
 
@@ -23,6 +23,8 @@
 #include "pvr/addons/PVRClientUID.h"
 #include "pvr/guilib/PVRGUIProgressHandler.h"
 #include "utils/JobManager.h"
+#include "utils/ParallelFor.h"
+#include "utils/Stopwatch.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
@@ -689,10 +691,16 @@ PVR_ERROR CPVRClients::GetChannels(const std::vector<std::shared_ptr<CPVRClient>
                                    std::vector<std::shared_ptr<CPVRChannel>>& channels,
                                    std::vector<int>& failedClients) const
 {
+  std::mutex channelsMutex;
   return ForClients(
       __FUNCTION__, clients,
-      [bRadio, &channels](const std::shared_ptr<const CPVRClient>& client) {
-        return client->GetChannels(bRadio, channels);
+      [bRadio, &channels, &channelsMutex](const std::shared_ptr<const CPVRClient>& client) {
+        std::vector<std::shared_ptr<CPVRChannel>> clientChannels;
+        const PVR_ERROR error = client->GetChannels(bRadio, clientChannels);
+
+        std::unique_lock<std::mutex> lock(channelsMutex);
+        channels.insert(channels.end(), clientChannels.begin(), clientChannels.end());
+        return error;
       },
       failedClients);
 }
@@ -727,10 +735,17 @@ PVR_ERROR CPVRClients::GetChannelGroupMembers(
     std::vector<std::shared_ptr<CPVRChannelGroupMember>>& groupMembers,
     std::vector<int>& failedClients) const
 {
+  std::mutex groupMembersMutex;
   return ForClients(
       __FUNCTION__, clients,
-      [group, &groupMembers](const std::shared_ptr<const CPVRClient>& client) {
-        return client->GetChannelGroupMembers(group, groupMembers);
+      [group, &groupMembers, &groupMembersMutex](const std::shared_ptr<const CPVRClient>& client) {
+        std::vector<std::shared_ptr<CPVRChannelGroupMember>> clientGroupMembers;
+        const PVR_ERROR error = client->GetChannelGroupMembers(group, clientGroupMembers);
+
+        std::unique_lock<std::mutex> lock(groupMembersMutex);
+        groupMembers.insert(groupMembers.end(), clientGroupMembers.begin(),
+                            clientGroupMembers.end());
+        return error;
       },
       failedClients);
 }
@@ -928,6 +943,20 @@ void LogClientWarning(const char* strFunctionName, const std::shared_ptr<const C
               client->ID());
 }
 
+PVR_ERROR CallClient(const char* strFunctionName,
+                     const std::function<PVR_ERROR(const std::shared_ptr<CPVRClient>&)>& function,
+                     const std::shared_ptr<CPVRClient>& client)
+{
+  CStopWatch timer;
+  timer.StartZero();
+
+  const PVR_ERROR error = function(client);
+
+  CLog::LogFC(LOGDEBUG, LOGPVR, "Called add-on function '{}' on client {} in {:.0f} ms. return={}",
+              strFunctionName, client->GetID(), timer.GetElapsedMilliseconds(), error);
+  return error;
+}
+
 } // unnamed namespace
 
 PVR_ERROR CPVRClients::ForCreatedClients(const char* strFunctionName,
@@ -1009,33 +1038,36 @@ PVR_ERROR CPVRClients::ForClients(const char* strFunctionName,
     }
   }
 
+  std::vector<std::shared_ptr<CPVRClient>> callableClients;
   for (const auto& client : clients)
   {
     if (std::none_of(failedClients.cbegin(), failedClients.cend(),
                      [&client](int failedClientId) { return failedClientId == client->GetID(); }))
-    {
-      //      CLog::LogFC(LOGDEBUG, LOGPVR, "Calling add-on function '{}' on client {}.", strFunctionName,
-      //                  client->GetID());
-
-      PVR_ERROR currentError = function(client);
-
-      //      CLog::LogFC(LOGDEBUG, LOGPVR, "Called add-on function '{}' on client {}. return={}",
-      //                  strFunctionName, client->GetID(), currentError);
+      callableClients.emplace_back(client);
+    else
+      LogClientWarning(strFunctionName, client);
+  }
 
-      if (currentError != PVR_ERROR_NO_ERROR && currentError != PVR_ERROR_NOT_IMPLEMENTED)
-      {
-        lastError = currentError;
-        failedClients.emplace_back(client->GetID());
+  // Backends are independent of each other, don't let a slow one delay the others.
+  std::vector<PVR_ERROR> errors(callableClients.size(), PVR_ERROR_NO_ERROR);
+  KODI::UTILS::ParallelFor(callableClients.size(), callableClients.size(),
+                           [strFunctionName, &function, &callableClients, &errors](size_t i) {
+                             errors[i] =
+                                 CallClient(strFunctionName, function, callableClients[i]);
+                           });
 
-        CLog::LogFC(LOGDEBUG, LOGPVR,
-                    "Added client {} to failed clients list after call to "
-                    "function '{}‘ returned error {}.",
-                    client->GetID(), strFunctionName, currentError);
-      }
-    }
-    else
+  for (size_t i = 0; i < callableClients.size(); ++i)
+  {
+    const PVR_ERROR currentError = errors[i];
+    if (currentError != PVR_ERROR_NO_ERROR && currentError != PVR_ERROR_NOT_IMPLEMENTED)
     {
-      LogClientWarning(strFunctionName, client);
+      lastError = currentError;
+      failedClients.emplace_back(callableClients[i]->GetID());
+
+      CLog::LogFC(LOGDEBUG, LOGPVR,
+                  "Added client {} to failed clients list after call to "
+                  "function '{}‘ returned error {}.",
+                  callableClients[i]->GetID(), strFunctionName, currentError);
     }
   }
   return lastError;
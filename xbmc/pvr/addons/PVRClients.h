@@ -455,6 +455,7 @@ struct SBackend
 
     /*!
      * @brief Wraps calls to the given clients in order to do common pre and post function invocation actions.
+     * The clients are called concurrently, thus the function must be thread safe if more than one client is given.
      * @param strFunctionName The function name, for logging purposes.
      * @param clients The clients to wrap.
      * @param function The function to wrap. It has to have return type PVR_ERROR and must take a const reference to a std::shared_ptr<CPVRClient> as parameter.
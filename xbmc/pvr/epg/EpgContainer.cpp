@@ -25,6 +25,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -267,6 +268,10 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
     // Note: We must lock the db the whole time, otherwise races may occur.
     database->Lock();
 
+    const auto start = std::chrono::steady_clock::now();
+    size_t persistedEpgs = 0;
+    size_t committedQueries = 0;
+
     XbmcThreads::EndTime<> processTimeslice{std::chrono::milliseconds(iMaxTimeslice)};
     for (const auto& epg : changedEpgs)
     {
@@ -276,6 +281,7 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
                     epg->GetChannelData()->ChannelName());
 
         bReturn &= epg->QueuePersistQuery(database);
+        ++persistedEpgs;
 
         size_t queryCount = database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
         if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
@@ -284,7 +290,10 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
                       queryCount);
           database->CommitDeleteQueries();
           database->CommitInsertQueries();
-          CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committed {} queries in loop.", queryCount);
+          committedQueries += queryCount;
+          CLog::LogFC(LOGDEBUG, LOGEPG,
+                      "EPG Container: committed {} queries in loop ({} of {} EPGs done).",
+                      queryCount, persistedEpgs, changedEpgs.size());
         }
       }
 
@@ -293,11 +302,19 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
 
     if (bReturn)
     {
+      committedQueries += database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
       database->CommitDeleteQueries();
       database->CommitInsertQueries();
     }
 
     database->Unlock();
+
+    CLog::LogFC(LOGDEBUG, LOGEPG,
+                "EPG Container: Persisted {} of {} changed EPGs with {} queries in {} ms.",
+                persistedEpgs, changedEpgs.size(), committedQueries,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
   }
 
   return bReturn;
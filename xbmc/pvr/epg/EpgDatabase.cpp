@@ -19,6 +19,7 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -30,6 +31,8 @@ using namespace PVR;
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_searchIndex.Clear();
+  m_searchIndex.SetLoaded(false);
   return CDatabase::Open(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg);
 }
 
@@ -360,6 +363,8 @@ bool CPVREpgDatabase::DeleteEpg()
   bReturn = DeleteValues("epgtags") || bReturn;
   bReturn = DeleteValues("lastepgscan") || bReturn;
 
+  m_searchIndex.Clear();
+
   return bReturn;
 }
 
@@ -574,6 +579,16 @@ public:
 
   bool HasSearchTerm() const { return !m_fragments.empty(); }
 
+  // Alternatives of terms which all must match, as the SQL evaluates them. Empty if an
+  // alternative has no term that must match, for example just negated ones.
+  std::vector<std::vector<std::string>> GetRequiredTerms() const
+  {
+    if (!m_bRequiredTermsComplete)
+      return {};
+
+    return m_requiredTerms;
+  }
+
   std::string ToSQL(const std::string& strFieldName) const
   {
     std::string result = "(";
@@ -601,6 +616,8 @@ private:
     std::string strFragment;
 
     bool bNextOR = false;
+    bool bNextAlternative = true;
+    bool bNextNegated = false;
     while (!strParsedSearchTerm.empty())
     {
       StringUtils::TrimLeft(strParsedSearchTerm);
@@ -612,6 +629,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        bNextNegated = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -620,6 +638,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " AND ";
         bNextOR = false;
+        bNextAlternative = false;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
@@ -628,6 +647,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " OR ";
         bNextOR = false;
+        bNextAlternative = true;
       }
       else
       {
@@ -638,6 +658,18 @@ private:
           if (bNextOR && !m_fragments.empty())
             strFragment += " OR "; // default operator
 
+          // AND binds stronger than OR
+          if (bNextAlternative || m_requiredTerms.empty())
+          {
+            if (!m_requiredTerms.empty() && m_requiredTerms.back().empty())
+              m_bRequiredTermsComplete = false;
+            m_requiredTerms.emplace_back();
+          }
+          if (!bNextNegated)
+            m_requiredTerms.back().emplace_back(strTerm);
+          bNextNegated = false;
+          bNextAlternative = true;
+
           strFragment += "(UPPER(";
 
           m_fragments.emplace_back(strFragment);
@@ -661,6 +693,9 @@ private:
 
     if (!strFragment.empty())
       m_fragments.emplace_back(strFragment);
+
+    if (!m_requiredTerms.empty() && m_requiredTerms.back().empty())
+      m_bRequiredTermsComplete = false;
   }
 
   static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm)
@@ -687,6 +722,8 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  std::vector<std::vector<std::string>> m_requiredTerms;
+  bool m_bRequiredTermsComplete = true;
 };
 
 } // unnamed namespace
@@ -810,6 +847,35 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     }
 
     filter.AppendWhere(strWhere);
+
+    // restrict the search to the tags the search index found, the LIKE filters above only have
+    // to check those then instead of every tag of the database
+    std::vector<CPVREpgSearchIndex::TagKey> candidates;
+    if (GetSearchCandidates(conv.GetRequiredTerms(), searchData.m_bSearchInDescription,
+                            candidates))
+    {
+      if (candidates.empty())
+        return {};
+
+      std::string strCandidates;
+      for (auto it = candidates.cbegin(); it != candidates.cend();)
+      {
+        const int iEpgID = it->first;
+        std::string strStartTimes;
+        for (; it != candidates.cend() && it->first == iEpgID; ++it)
+        {
+          if (!strStartTimes.empty())
+            strStartTimes += ", ";
+          strStartTimes += PrepareSQL("%u", static_cast<unsigned int>(it->second));
+        }
+
+        if (!strCandidates.empty())
+          strCandidates += " OR ";
+        strCandidates +=
+            PrepareSQL("(idEpg = %u AND iStartTime IN (", iEpgID) + strStartTimes + "))";
+      }
+      filter.AppendWhere(strCandidates);
+    }
   }
 
   if (BuildSQL(strQuery, filter, strQuery))
@@ -837,6 +903,69 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   return {};
 }
 
+bool CPVREpgDatabase::GetSearchCandidates(
+    const std::vector<std::vector<std::string>>& termGroups,
+    bool bSearchInPlot,
+    std::vector<CPVREpgSearchIndex::TagKey>& candidates) const
+{
+  // the index knows only the tags written by this instance. A MySQL database may be shared with
+  // other clients.
+  if (!m_sqlite || termGroups.empty())
+    return false;
+
+  if (!m_searchIndex.IsLoaded() && !LoadSearchIndex())
+    return false;
+
+  return m_searchIndex.GetCandidates(termGroups, bSearchInPlot, candidates);
+}
+
+bool CPVREpgDatabase::LoadSearchIndex() const
+{
+  // queued tags are not in the database yet, they would be missing in the index
+  if (!m_pDS || !m_pDS2 || m_pDS2->insert_sql_count() > 0)
+    return false;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  m_searchIndex.Clear();
+
+  const std::string strQuery =
+      PrepareSQL("SELECT idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot FROM epgtags;");
+  try
+  {
+    if (m_pDS->query(strQuery))
+    {
+      while (!m_pDS->eof())
+      {
+        m_searchIndex.Add(m_pDS->fv("idEpg").get_asInt(),
+                          static_cast<time_t>(m_pDS->fv("iStartTime").get_asInt()),
+                          static_cast<time_t>(m_pDS->fv("iEndTime").get_asInt()),
+                          m_pDS->fv("sTitle").get_asString(),
+                          m_pDS->fv("sPlotOutline").get_asString(),
+                          m_pDS->fv("sPlot").get_asString());
+        m_pDS->next();
+      }
+      m_pDS->close();
+
+      m_searchIndex.SetLoaded(true);
+
+      CLog::LogFC(LOGDEBUG, LOGEPG, "Loaded search index with {} tags in {} ms",
+                  m_searchIndex.GetSize(),
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count());
+      return true;
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Could not load search index");
+  }
+
+  m_searchIndex.Clear();
+  return false;
+}
+
 std::shared_ptr<CPVREpgInfoTag> CPVREpgDatabase::GetEpgTagByUniqueBroadcastID(
     int iEpgID, unsigned int iUniqueBroadcastId) const
 {
@@ -1063,30 +1192,6 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTagsByMinEnd
   return {};
 }
 
-bool CPVREpgDatabase::QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
-                                                                  const CDateTime& minEndTime,
-                                                                  const CDateTime& maxStartTime)
-{
-  time_t minEnd;
-  minEndTime.GetAsTime(minEnd);
-
-  time_t maxStart;
-  maxStartTime.GetAsTime(maxStart);
-
-  Filter filter;
-
-  std::unique_lock<CCriticalSection> lock(m_critSection);
-  filter.AppendWhere(PrepareSQL("idEpg = %u AND iEndTime >= %u AND iStartTime <= %u", iEpgID,
-                                static_cast<unsigned int>(minEnd),
-                                static_cast<unsigned int>(maxStart)));
-
-  std::string strQuery;
-  if (BuildSQL("DELETE FROM epgtags", filter, strQuery))
-    return QueueDeleteQuery(strQuery);
-
-  return false;
-}
-
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetAllEpgTags(int iEpgID) const
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
@@ -1228,6 +1333,7 @@ bool CPVREpgDatabase::DeleteEpgTags(int iEpgId, const CDateTime& maxEndTime)
   std::unique_lock<CCriticalSection> lock(m_critSection);
   filter.AppendWhere(
       PrepareSQL("idEpg = %u AND iEndTime < %u", iEpgId, static_cast<unsigned int>(iMaxEndTime)));
+  m_searchIndex.RemoveByMaxEndTime(iEpgId, iMaxEndTime);
   return DeleteValues("epgtags", filter);
 }
 
@@ -1237,6 +1343,7 @@ bool CPVREpgDatabase::DeleteEpgTags(int iEpgId)
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
   filter.AppendWhere(PrepareSQL("idEpg = %u", iEpgId));
+  m_searchIndex.Remove(iEpgId);
   return DeleteValues("epgtags", filter);
 }
 
@@ -1246,20 +1353,33 @@ bool CPVREpgDatabase::QueueDeleteEpgTags(int iEpgId)
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
   filter.AppendWhere(PrepareSQL("idEpg = %u", iEpgId));
+  m_searchIndex.Remove(iEpgId);
 
   std::string strQuery;
   BuildSQL(PrepareSQL("DELETE FROM %s ", "epgtags"), filter, strQuery);
   return QueueDeleteQuery(strQuery);
 }
 
-bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+namespace
 {
-  if (tag.EpgID() <= 0)
-  {
-    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
-    return false;
-  }
+// Columns written by the persist queries. The database id goes last, it is only written for
+// tags that were loaded from the database.
+constexpr const char* PERSIST_COLUMNS =
+    "idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, "
+    "sWriter, iYear, sIMDBNumber, sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, "
+    "iParentalRating, iStarRating, iSeriesId, iEpisodeId, iEpisodePart, sEpisodeName, iFlags, "
+    "sSeriesLink, sParentalRatingCode, iBroadcastUid, sParentalRatingIcon, sParentalRatingSource";
+
+// Max tags written by a single multi-row statement.
+constexpr size_t PERSIST_ROWS_PER_QUERY = 100;
+
+// Max size of the values of a single statement. Plots can be rather long, stay well below
+// SQLite's default SQLITE_MAX_SQL_LENGTH of 1,000,000 bytes, which applies to each statement.
+constexpr size_t PERSIST_VALUES_PER_QUERY = 500000;
+} // unnamed namespace
 
+std::string CPVREpgDatabase::GetPersistValues(const CPVREpgInfoTag& tag) const
+{
   time_t iStartTime, iEndTime;
   tag.StartAsUTC().GetAsTime(iStartTime);
   tag.EndAsUTC().GetAsTime(iEndTime);
@@ -1268,60 +1388,124 @@ bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
   if (tag.FirstAired().IsValid())
     sFirstAired = tag.FirstAired().GetAsW3CDate();
 
-  int iBroadcastId = tag.DatabaseID();
-  std::string strQuery;
+  std::string strValues = PrepareSQL(
+      "(%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, '%s', '%s', "
+      "%i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s'",
+      tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
+      tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
+      tag.OriginalTitle().c_str(), tag.DeTokenize(tag.Cast()).c_str(),
+      tag.DeTokenize(tag.Directors()).c_str(), tag.DeTokenize(tag.Writers()).c_str(), tag.Year(),
+      tag.IMDBNumber().c_str(), tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
+      tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
+      tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
+      tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
+      tag.UniqueBroadcastID(), tag.ParentalRatingIcon().c_str(),
+      tag.ParentalRatingSource().c_str());
+
+  if (tag.DatabaseID() >= 0)
+    strValues += PrepareSQL(", %i", tag.DatabaseID());
+
+  strValues += ")";
+  return strValues;
+}
+
+bool CPVREpgDatabase::QueuePersistQueries(int iEpgID,
+                                          const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags)
+{
+  if (iEpgID <= 0)
+  {
+    CLog::LogF(LOGERROR, "EPG id {} is not valid", iEpgID);
+    return false;
+  }
 
   std::unique_lock<CCriticalSection> lock(m_critSection);
 
-  if (iBroadcastId < 0)
+  bool bReturn = true;
+
+  // remove any conflicting events from database before persisting the new events
+  std::string strConflicts;
+
+  // tags loaded from the database have an id, new ones get one assigned. Different columns,
+  // thus different statements.
+  std::string strNewValues;
+  std::string strExistingValues;
+  size_t rows = 0;
+
+  const auto queueChunk = [&]() {
+    if (rows == 0)
+      return;
+
+    QueueDeleteQuery(
+        PrepareSQL("DELETE FROM epgtags WHERE idEpg = %u AND (", iEpgID) + strConflicts + ");");
+
+    if (!strNewValues.empty())
+      QueueInsertQuery(StringUtils::Format("REPLACE INTO epgtags ({}) VALUES {};", PERSIST_COLUMNS,
+                                           strNewValues));
+    if (!strExistingValues.empty())
+      QueueInsertQuery(StringUtils::Format("REPLACE INTO epgtags ({}, idBroadcast) VALUES {};",
+                                           PERSIST_COLUMNS, strExistingValues));
+
+    strConflicts.clear();
+    strNewValues.clear();
+    strExistingValues.clear();
+    rows = 0;
+  };
+
+  for (const auto& tagPtr : tags)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, sParentalRatingIcon, sParentalRatingSource) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), tag.DeTokenize(tag.Cast()).c_str(),
-        tag.DeTokenize(tag.Directors()).c_str(), tag.DeTokenize(tag.Writers()).c_str(), tag.Year(),
-        tag.IMDBNumber().c_str(), tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), tag.ParentalRatingIcon().c_str(),
-        tag.ParentalRatingSource().c_str());
+    const CPVREpgInfoTag& tag = *tagPtr;
+
+    // the values are written with the id of the tag, the conflicts are deleted with iEpgID
+    if (tag.EpgID() != iEpgID)
+    {
+      CLog::LogF(LOGERROR, "Tag '{}' does not belong to EPG id {}", tag.Title(), iEpgID);
+      bReturn = false;
+      continue;
+    }
+
+    time_t iStartTime, iEndTime;
+    tag.StartAsUTC().GetAsTime(iStartTime);
+    tag.EndAsUTC().GetAsTime(iEndTime);
+
+    const std::string strConflict = PrepareSQL("(iEndTime >= %u AND iStartTime <= %u)",
+                                               static_cast<unsigned int>(iStartTime + 1),
+                                               static_cast<unsigned int>(iEndTime - 1));
+    const std::string strTagValues = GetPersistValues(tag);
+    std::string& strValues = tag.DatabaseID() < 0 ? strNewValues : strExistingValues;
+
+    if (rows == PERSIST_ROWS_PER_QUERY ||
+        strConflicts.size() + strConflict.size() > PERSIST_VALUES_PER_QUERY ||
+        strValues.size() + strTagValues.size() > PERSIST_VALUES_PER_QUERY)
+      queueChunk();
+
+    if (!strConflicts.empty())
+      strConflicts += " OR ";
+    strConflicts += strConflict;
+
+    if (!strValues.empty())
+      strValues += ", ";
+    strValues += strTagValues;
+    rows++;
   }
-  else
+
+  queueChunk();
+
+  if (m_searchIndex.IsLoaded())
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, idBroadcast, sParentalRatingIcon, sParentalRatingSource) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, %i, '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), tag.DeTokenize(tag.Cast()).c_str(),
-        tag.DeTokenize(tag.Directors()).c_str(), tag.DeTokenize(tag.Writers()).c_str(), tag.Year(),
-        tag.IMDBNumber().c_str(), tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), iBroadcastId, tag.ParentalRatingIcon().c_str(),
-        tag.ParentalRatingSource().c_str());
+    for (const auto& tag : tags)
+    {
+      if (tag->EpgID() != iEpgID)
+        continue;
+
+      time_t iStartTime, iEndTime;
+      tag->StartAsUTC().GetAsTime(iStartTime);
+      tag->EndAsUTC().GetAsTime(iEndTime);
+      m_searchIndex.Replace(iEpgID, iStartTime, iEndTime, tag->Title(), tag->PlotOutline(),
+                            tag->Plot());
+    }
   }
 
-  QueueInsertQuery(strQuery);
-  return true;
+  return bReturn;
 }
 
 int CPVREpgDatabase::GetLastEPGId() const
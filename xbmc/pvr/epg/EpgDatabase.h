@@ -9,9 +9,11 @@
 #pragma once
 
 #include "dbwrappers/Database.h"
+#include "pvr/epg/EpgSearchIndex.h"
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 class CDateTime;
@@ -225,18 +227,6 @@ namespace PVR
     std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsByMinEndMaxStartTime(
         int iEpgID, const CDateTime& minEndTime, const CDateTime& maxStartTime) const;
 
-    /*!
-     * @brief Write the query to delete all EPG tags in range of given EPG id, min end time and max
-     * start time to db query queue. .
-     * @param iEpgID The ID of the EPG for the tags to delete.
-     * @param minEndTime The min end time for the tags to delete.
-     * @param maxStartTime The max start time for the tags to delete.
-     * @return True if it was removed or queued successfully, false otherwise.
-     */
-    bool QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
-                                                     const CDateTime& minEndTime,
-                                                     const CDateTime& maxStartTime);
-
     /*!
      * @brief Get the last stored EPG scan time.
      * @param iEpgId The table to update the time for. Use 0 for a global value.
@@ -291,11 +281,15 @@ namespace PVR
     bool QueueDeleteEpgTags(int iEpgId);
 
     /*!
-     * @brief Write the query to persist the given EPG tag to db query queue.
-     * @param tag The tag to persist.
-     * @return True on success, false otherwise.
+     * @brief Write the queries to persist the given EPG tags to db query queue. Tags are written
+     * with multi-row statements and conflicting tags in the database are deleted with a single
+     * query per statement, which is a lot cheaper than persisting the tags one by one.
+     * @param iEpgID The ID of the EPG the tags belong to.
+     * @param tags The tags to persist, sorted by start time and not overlapping.
+     * @return True on success, false if a tag does not belong to the given EPG. Such tags are
+     * skipped, the others are still persisted.
      */
-    bool QueuePersistQuery(const CPVREpgInfoTag& tag);
+    bool QueuePersistQueries(int iEpgID, const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags);
 
     /*!
      * @return Last EPG id in the database
@@ -376,6 +370,29 @@ namespace PVR
     std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(
         bool bRadio, const std::unique_ptr<dbiplus::Dataset>& pDS) const;
 
+    /*!
+     * @brief Get the values tuple of a persist query for the given tag.
+     */
+    std::string GetPersistValues(const CPVREpgInfoTag& tag) const;
+
+    /*!
+     * @brief Get the tags which possibly match the given search terms from the search index.
+     * @param termGroups Alternatives of search terms which all must match.
+     * @param bSearchInPlot Whether the search terms are matched against the plot.
+     * @param candidates The candidates.
+     * @return False if the index can't narrow down the search, true otherwise.
+     */
+    bool GetSearchCandidates(const std::vector<std::vector<std::string>>& termGroups,
+                             bool bSearchInPlot,
+                             std::vector<CPVREpgSearchIndex::TagKey>& candidates) const;
+
+    /*!
+     * @brief Fill the search index with all tags of the database.
+     * @return True on success, false otherwise.
+     */
+    bool LoadSearchIndex() const;
+
     mutable CCriticalSection m_critSection;
+    mutable CPVREpgSearchIndex m_searchIndex;
   };
 }
@@ -528,17 +528,6 @@ bool CPVREpgInfoTag::Update(const CPVREpgInfoTag& tag, bool bUpdateBroadcastId /
   return bChanged;
 }
 
-bool CPVREpgInfoTag::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database)
-{
-  if (!database)
-  {
-    CLog::LogF(LOGERROR, "Could not open the EPG database");
-    return false;
-  }
-
-  return database->QueuePersistQuery(*this);
-}
-
 std::vector<EDL::Edit> CPVREpgInfoTag::GetEdl() const
 {
   std::vector<EDL::Edit> edls;
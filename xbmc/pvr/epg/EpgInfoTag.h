@@ -33,6 +33,7 @@ class CPVREpgInfoTag final : public ISerializable,
                              public std::enable_shared_from_this<CPVREpgInfoTag>
 {
   friend class CPVREpgDatabase;
+  friend class CPVREpgTagsStore;
 
 public:
   static const std::string IMAGE_OWNER_PATTERN;
@@ -386,13 +387,6 @@ public:
    */
   bool IsPlayable() const;
 
-  /*!
-   * @brief Write query to persist this tag in the query queue of the given database.
-   * @param database The database.
-   * @return True on success, false otherwise.
-   */
-  bool QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database);
-
   /*!
    * @brief Update the information in this tag with the info in the given tag.
    * @param tag The new info.
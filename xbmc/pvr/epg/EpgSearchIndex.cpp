@@ -0,0 +1,305 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgSearchIndex.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+using namespace PVR;
+
+namespace
+{
+// Shorter fragments are part of too many words to narrow down a search.
+constexpr size_t MIN_FRAGMENT_LENGTH = 2;
+
+// Beyond this the candidates are no real restriction anymore.
+constexpr size_t MAX_CANDIDATES = 1000;
+
+// Removed tags are compacted away once there are more than this and more than tags left.
+constexpr size_t MIN_REMOVED_TO_COMPACT = 1000;
+
+bool IsWordChar(char c)
+{
+  // bytes of multi-byte UTF-8 sequences are word characters
+  const unsigned char uc = static_cast<unsigned char>(c);
+  return uc >= 0x80 || (uc >= '0' && uc <= '9') || (uc >= 'a' && uc <= 'z') ||
+         (uc >= 'A' && uc <= 'Z');
+}
+
+char ToLower(char c)
+{
+  // the database compares ASCII case-insensitive only, so does the index
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+void AppendWords(const std::string& strText, std::vector<std::string>& words)
+{
+  std::string strWord;
+  for (const char c : strText)
+  {
+    if (IsWordChar(c))
+    {
+      strWord += ToLower(c);
+    }
+    else if (!strWord.empty())
+    {
+      words.emplace_back(std::move(strWord));
+      strWord.clear();
+    }
+  }
+
+  if (!strWord.empty())
+    words.emplace_back(std::move(strWord));
+}
+
+void SortUnique(std::vector<std::string>& words)
+{
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+}
+} // unnamed namespace
+
+void CPVREpgSearchIndex::Clear()
+{
+  m_tags.clear();
+  m_tagIds.clear();
+  m_words.clear();
+  m_iRemoved = 0;
+}
+
+void CPVREpgSearchIndex::Replace(int iEpgID,
+                                 time_t start,
+                                 time_t end,
+                                 const std::string& strTitle,
+                                 const std::string& strPlotOutline,
+                                 const std::string& strPlot)
+{
+  // the database drops the overlapping tags of the EPG and the one with the same start time
+  auto it = m_tagIds.lower_bound({iEpgID, start});
+  while (it != m_tagIds.begin())
+  {
+    const auto prev = std::prev(it);
+    if (prev->first.first != iEpgID || m_tags[prev->second].end <= start)
+      break;
+
+    RemoveTag(prev);
+  }
+
+  while (it != m_tagIds.end() && it->first.first == iEpgID &&
+         (it->first.second < end || it->first.second == start))
+  {
+    const auto next = std::next(it);
+    RemoveTag(it);
+    it = next;
+  }
+
+  Add(iEpgID, start, end, strTitle, strPlotOutline, strPlot);
+}
+
+void CPVREpgSearchIndex::Add(int iEpgID,
+                             time_t start,
+                             time_t end,
+                             const std::string& strTitle,
+                             const std::string& strPlotOutline,
+                             const std::string& strPlot)
+{
+  const auto it = m_tagIds.find({iEpgID, start});
+  if (it != m_tagIds.end())
+    RemoveTag(it);
+
+  const TagId id = static_cast<TagId>(m_tags.size());
+  m_tags.push_back({{iEpgID, start}, end, false});
+  m_tagIds.emplace(TagKey{iEpgID, start}, id);
+
+  std::vector<std::string> words;
+  AppendWords(strTitle, words);
+  AppendWords(strPlotOutline, words);
+  SortUnique(words);
+
+  std::vector<std::string> plotWords;
+  AppendWords(strPlot, plotWords);
+  SortUnique(plotWords);
+
+  for (const auto& word : words)
+    m_words[word].emplace_back(id * 2);
+
+  for (const auto& word : plotWords)
+  {
+    if (!std::binary_search(words.cbegin(), words.cend(), word))
+      m_words[word].emplace_back(id * 2 + 1);
+  }
+
+  Compact();
+}
+
+void CPVREpgSearchIndex::Remove(int iEpgID)
+{
+  auto it = m_tagIds.lower_bound({iEpgID, std::numeric_limits<time_t>::min()});
+  while (it != m_tagIds.end() && it->first.first == iEpgID)
+  {
+    const auto next = std::next(it);
+    RemoveTag(it);
+    it = next;
+  }
+
+  Compact();
+}
+
+void CPVREpgSearchIndex::RemoveByMaxEndTime(int iEpgID, time_t maxEnd)
+{
+  auto it = m_tagIds.lower_bound({iEpgID, std::numeric_limits<time_t>::min()});
+  while (it != m_tagIds.end() && it->first.first == iEpgID && it->first.second < maxEnd)
+  {
+    const auto next = std::next(it);
+    if (m_tags[it->second].end < maxEnd)
+      RemoveTag(it);
+    it = next;
+  }
+
+  Compact();
+}
+
+void CPVREpgSearchIndex::RemoveTag(std::map<TagKey, TagId>::iterator it)
+{
+  // the postings are dropped on compaction
+  m_tags[it->second].bRemoved = true;
+  m_tagIds.erase(it);
+  m_iRemoved++;
+}
+
+void CPVREpgSearchIndex::Compact()
+{
+  if (m_iRemoved < MIN_REMOVED_TO_COMPACT || m_iRemoved < m_tagIds.size())
+    return;
+
+  std::vector<TagId> newIds(m_tags.size());
+  std::vector<Tag> tags;
+  tags.reserve(m_tagIds.size());
+  for (auto& tagId : m_tagIds)
+  {
+    newIds[tagId.second] = static_cast<TagId>(tags.size());
+    tags.emplace_back(m_tags[tagId.second]);
+    tagId.second = newIds[tagId.second];
+  }
+
+  for (auto it = m_words.begin(); it != m_words.end();)
+  {
+    std::vector<uint32_t> postings;
+    for (const uint32_t posting : it->second)
+    {
+      const TagId id = posting / 2;
+      if (!m_tags[id].bRemoved)
+        postings.emplace_back(newIds[id] * 2 + posting % 2);
+    }
+
+    if (postings.empty())
+    {
+      it = m_words.erase(it);
+    }
+    else
+    {
+      std::sort(postings.begin(), postings.end());
+      it->second = std::move(postings);
+      ++it;
+    }
+  }
+
+  m_tags = std::move(tags);
+  m_iRemoved = 0;
+}
+
+bool CPVREpgSearchIndex::GetCandidates(const std::string& strTerm,
+                                       bool bSearchInPlot,
+                                       std::vector<TagId>& ids) const
+{
+  std::vector<std::string> fragments;
+  AppendWords(strTerm, fragments);
+
+  const auto longest =
+      std::max_element(fragments.cbegin(), fragments.cend(),
+                       [](const std::string& a, const std::string& b)
+                       { return a.size() < b.size(); });
+  if (longest == fragments.cend() || longest->size() < MIN_FRAGMENT_LENGTH)
+    return false;
+
+  for (const auto& [word, postings] : m_words)
+  {
+    if (word.find(*longest) == std::string::npos)
+      continue;
+
+    for (const uint32_t posting : postings)
+    {
+      if (bSearchInPlot || posting % 2 == 0)
+        ids.emplace_back(posting / 2);
+    }
+  }
+
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  return true;
+}
+
+bool CPVREpgSearchIndex::GetCandidates(const std::vector<std::vector<std::string>>& termGroups,
+                                       bool bSearchInPlot,
+                                       std::vector<TagKey>& candidates) const
+{
+  if (termGroups.empty())
+    return false;
+
+  std::vector<TagId> result;
+  for (const auto& terms : termGroups)
+  {
+    // all terms of a group must match, terms too short to look up don't restrict it
+    std::vector<TagId> groupIds;
+    bool bRestricted = false;
+    for (const auto& term : terms)
+    {
+      std::vector<TagId> ids;
+      if (!GetCandidates(term, bSearchInPlot, ids))
+        continue;
+
+      if (bRestricted)
+      {
+        std::vector<TagId> intersection;
+        std::set_intersection(groupIds.cbegin(), groupIds.cend(), ids.cbegin(), ids.cend(),
+                              std::back_inserter(intersection));
+        groupIds = std::move(intersection);
+      }
+      else
+      {
+        groupIds = std::move(ids);
+        bRestricted = true;
+      }
+    }
+
+    if (!bRestricted)
+      return false;
+
+    std::vector<TagId> merged;
+    std::set_union(result.cbegin(), result.cend(), groupIds.cbegin(), groupIds.cend(),
+                   std::back_inserter(merged));
+    result = std::move(merged);
+  }
+
+  for (const TagId id : result)
+  {
+    if (!m_tags[id].bRemoved)
+      candidates.emplace_back(m_tags[id].key);
+  }
+
+  if (candidates.size() > MAX_CANDIDATES)
+  {
+    candidates.clear();
+    return false;
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  return true;
+}
@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace PVR
+{
+/*!
+ * @brief Inverted word index over title, plot outline and plot of the persisted EPG tags.
+ *
+ * The index maps the lower case words of the texts to the tags containing them. It doesn't
+ * answer searches itself, it narrows them down to candidate tags. A search term matches a tag
+ * only if the longest run of word characters of the term is part of a word of the tag, thus the
+ * candidates are found by scanning the (small) word dictionary instead of all texts.
+ *
+ * Candidates may be stale, tags get removed from the index lazily. The caller has to verify them.
+ * The index isn't thread safe.
+ */
+class CPVREpgSearchIndex
+{
+public:
+  using TagKey = std::pair<int, time_t>; // EPG id, start time
+
+  /*!
+   * @brief Check whether the index was filled with all tags of the database.
+   * @return True if loaded, false otherwise.
+   */
+  bool IsLoaded() const { return m_bLoaded; }
+
+  /*!
+   * @brief Mark the index as (not) containing all tags of the database.
+   * @param bLoaded The new state.
+   */
+  void SetLoaded(bool bLoaded) { m_bLoaded = bLoaded; }
+
+  /*!
+   * @brief Drop all tags. Does not change the loaded state.
+   */
+  void Clear();
+
+  /*!
+   * @brief Add a tag loaded from the database, replacing the one with the same start time.
+   */
+  void Add(int iEpgID,
+           time_t start,
+           time_t end,
+           const std::string& strTitle,
+           const std::string& strPlotOutline,
+           const std::string& strPlot);
+
+  /*!
+   * @brief Add a tag about to be persisted, replacing the tags of the same EPG it overlaps
+   * with, like persisting it does in the database.
+   */
+  void Replace(int iEpgID,
+               time_t start,
+               time_t end,
+               const std::string& strTitle,
+               const std::string& strPlotOutline,
+               const std::string& strPlot);
+
+  /*!
+   * @brief Remove all tags of the given EPG.
+   * @param iEpgID The ID of the EPG.
+   */
+  void Remove(int iEpgID);
+
+  /*!
+   * @brief Remove all tags of the given EPG with an end time before the given time.
+   * @param iEpgID The ID of the EPG.
+   * @param maxEnd The time.
+   */
+  void RemoveByMaxEndTime(int iEpgID, time_t maxEnd);
+
+  /*!
+   * @brief Get the tags which possibly match the given search terms.
+   * @param termGroups Alternatives of search terms which all must match.
+   * @param bSearchInPlot Whether the search terms are matched against the plot.
+   * @param candidates The candidates, sorted.
+   * @return False if the terms can't be narrowed down to a reasonable amount of tags, true
+   * otherwise.
+   */
+  bool GetCandidates(const std::vector<std::vector<std::string>>& termGroups,
+                     bool bSearchInPlot,
+                     std::vector<TagKey>& candidates) const;
+
+  /*!
+   * @brief Get the number of tags in the index.
+   */
+  size_t GetSize() const { return m_tagIds.size(); }
+
+private:
+  using TagId = uint32_t;
+
+  struct Tag
+  {
+    TagKey key;
+    time_t end;
+    bool bRemoved;
+  };
+
+  bool GetCandidates(const std::string& strTerm, bool bSearchInPlot, std::vector<TagId>& ids) const;
+  void RemoveTag(std::map<TagKey, TagId>::iterator it);
+  void Compact();
+
+  bool m_bLoaded = false;
+  std::vector<Tag> m_tags;
+  std::map<TagKey, TagId> m_tagIds; // tags not removed
+  // postings are tag id * 2, plus 1 if the word is contained in the plot only
+  std::unordered_map<std::string, std::vector<uint32_t>> m_words;
+  size_t m_iRemoved = 0;
+};
+
+} // namespace PVR
@@ -16,18 +16,17 @@
 namespace PVR
 {
 class CPVREpgChannelData;
-class CPVREpgDatabase;
 class CPVREpgInfoTag;
+class CPVREpgTagsStore;
 
 class CPVREpgTagsCache
 {
 public:
   CPVREpgTagsCache() = delete;
-  CPVREpgTagsCache(int iEpgID,
-                   const std::shared_ptr<CPVREpgChannelData>& channelData,
-                   const std::shared_ptr<CPVREpgDatabase>& database,
+  CPVREpgTagsCache(const std::shared_ptr<CPVREpgChannelData>& channelData,
+                   const CPVREpgTagsStore& tagsStore,
                    const std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& changedTags)
-    : m_iEpgID(iEpgID), m_channelData(channelData), m_database(database), m_changedTags(changedTags)
+    : m_channelData(channelData), m_tagsStore(tagsStore), m_changedTags(changedTags)
   {
   }
 
@@ -45,9 +44,8 @@ private:
   void RefreshLastEndedTag(const CDateTime& activeTime);
   void RefreshNextStartingTag(const CDateTime& activeTime);
 
-  int m_iEpgID;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
-  std::shared_ptr<CPVREpgDatabase> m_database;
+  const CPVREpgTagsStore& m_tagsStore;
   const std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& m_changedTags;
 
   std::shared_ptr<CPVREpgInfoTag> m_lastEndedTag;
@@ -12,6 +12,7 @@
 #include "pvr/epg/EpgDatabase.h"
 #include "pvr/epg/EpgInfoTag.h"
 #include "pvr/epg/EpgTagsCache.h"
+#include "pvr/epg/EpgTagsStore.h"
 #include "utils/log.h"
 
 #include <algorithm>
@@ -30,7 +31,8 @@ CPVREpgTagsContainer::CPVREpgTagsContainer(int iEpgID,
   : m_iEpgID(iEpgID),
     m_channelData(channelData),
     m_database(database),
-    m_tagsCache(new CPVREpgTagsCache(iEpgID, channelData, database, m_changedTags))
+    m_tagsStore(new CPVREpgTagsStore(iEpgID, database)),
+    m_tagsCache(new CPVREpgTagsCache(channelData, *m_tagsStore, m_changedTags))
 {
 }
 
@@ -39,6 +41,7 @@ CPVREpgTagsContainer::~CPVREpgTagsContainer() = default;
 void CPVREpgTagsContainer::SetEpgID(int iEpgID)
 {
   m_iEpgID = iEpgID;
+  m_tagsStore->SetEpgID(iEpgID);
   for (const auto& tag : m_changedTags)
     tag.second->SetEpgID(iEpgID);
 }
@@ -142,7 +145,7 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     const CDateTime maxEventStart = (*tags.m_changedTags.crbegin()).second->EndAsUTC();
 
     std::vector<std::shared_ptr<CPVREpgInfoTag>> existingTags =
-        m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+        m_tagsStore->GetTagsByMinEndMaxStartTime(minEventEnd, maxEventStart);
 
     if (!m_changedTags.empty())
     {
@@ -332,7 +335,10 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
     m_tagsCache->Reset();
 
   if (m_database)
+  {
     m_database->DeleteEpgTags(m_iEpgID, time);
+    m_tagsStore->RemoveByMaxEndTime(time);
+  }
 }
 
 void CPVREpgTagsContainer::Clear()
@@ -347,7 +353,7 @@ bool CPVREpgTagsContainer::IsEmpty() const
     return false;
 
   if (m_database)
-    return !m_database->HasTags(m_iEpgID);
+    return !m_tagsStore->HasTags();
 
   return true;
 }
@@ -359,7 +365,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTag(const CDateTime& st
     return (*it).second;
 
   if (m_database)
-    return CreateEntry(m_database->GetEpgTagByStartTime(m_iEpgID, startTime));
+    return CreateEntry(m_tagsStore->GetTagByStartTime(startTime));
 
   return {};
 }
@@ -378,7 +384,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTag(unsigned int iUniqu
     return (*it).second;
 
   if (m_database)
-    return CreateEntry(m_database->GetEpgTagByUniqueBroadcastID(m_iEpgID, iUniqueBroadcastID));
+    return CreateEntry(m_tagsStore->GetTagByUniqueBroadcastID(iUniqueBroadcastID));
 
   return {};
 }
@@ -397,7 +403,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagByDatabaseID(int iDa
     return (*it).second;
 
   if (m_database)
-    return CreateEntry(m_database->GetEpgTagByDatabaseID(m_iEpgID, iDatabaseID));
+    return CreateEntry(m_tagsStore->GetTagByDatabaseID(iDatabaseID));
 
   return {};
 }
@@ -419,7 +425,7 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagBetween(const CDateT
   if (m_database)
   {
     const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
-        CreateEntries(m_database->GetEpgTagsByMinStartMaxEndTime(m_iEpgID, start, end));
+        CreateEntries(m_tagsStore->GetTagsByMinStartMaxEndTime(start, end));
     if (!tags.empty())
     {
       if (tags.size() > 1)
@@ -487,7 +493,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     bool loadFromDb = true;
     if (!m_changedTags.empty())
     {
-      const CDateTime lastEnd = m_database->GetLastEndTime(m_iEpgID);
+      const CDateTime lastEnd = m_tagsStore->GetLastEndTime();
       if (!lastEnd.IsValid() || lastEnd < minEventEnd)
       {
         // nothing in the db yet. take what we have in memory.
@@ -498,7 +504,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      tags = m_tagsStore->GetTagsByMinEndMaxStartTime(minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -542,11 +548,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     if (result.empty())
     {
       // create single gap tag
-      CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+      CDateTime maxEnd = m_tagsStore->GetMaxEndTime(minEventEnd);
       if (!maxEnd.IsValid() || maxEnd < timelineStart)
         maxEnd = timelineStart;
 
-      CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+      CDateTime minStart = m_tagsStore->GetMinStartTime(maxEventStart);
       if (!minStart.IsValid() || minStart > timelineEnd)
         minStart = timelineEnd;
 
@@ -557,7 +563,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.front()->StartAsUTC() > minEventEnd)
       {
         // prepend gap tag
-        CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+        CDateTime maxEnd = m_tagsStore->GetMaxEndTime(minEventEnd);
         if (!maxEnd.IsValid() || maxEnd < timelineStart)
           maxEnd = timelineStart;
 
@@ -567,7 +573,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.back()->EndAsUTC() < maxEventStart)
       {
         // append gap tag
-        CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+        CDateTime minStart = m_tagsStore->GetMinStartTime(maxEventStart);
         if (!minStart.IsValid() || minStart > timelineEnd)
           minStart = timelineEnd;
 
@@ -586,7 +592,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
   if (m_database)
   {
     std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    if (!m_changedTags.empty() && !m_database->HasTags(m_iEpgID))
+    if (!m_changedTags.empty() && !m_tagsStore->HasTags())
     {
       // nothing in the db yet. take what we have in memory.
       std::transform(m_changedTags.cbegin(), m_changedTags.cend(), std::back_inserter(tags),
@@ -596,7 +602,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
     }
     else
     {
-      tags = m_database->GetAllEpgTags(m_iEpgID);
+      tags = m_tagsStore->GetAllTags();
 
       if (!m_changedTags.empty())
       {
@@ -638,21 +644,30 @@ void CPVREpgTagsContainer::QueuePersistQuery()
                 m_changedTags.size(), m_deletedTags.size());
 
     for (const auto& tag : m_deletedTags)
+    {
       m_database->QueueDeleteTagQuery(*tag.second);
+      m_tagsStore->RemoveByDatabaseID(tag.second->DatabaseID());
+    }
 
     m_deletedTags.clear();
 
     FixOverlappingEvents(m_changedTags);
 
-    for (const auto& tag : m_changedTags)
+    if (!m_changedTags.empty())
     {
-      // remove any conflicting events from database before persisting the new event
-      m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(
-          m_iEpgID, tag.second->StartAsUTC() + ONE_SECOND, tag.second->EndAsUTC() - ONE_SECOND);
+      std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+      tags.reserve(m_changedTags.size());
+      std::transform(m_changedTags.cbegin(), m_changedTags.cend(), std::back_inserter(tags),
+                     [](const auto& tag) { return tag.second; });
 
-      tag.second->QueuePersistQuery(m_database);
+      m_database->QueuePersistQueries(m_iEpgID, tags);
     }
 
+    // the database assigns the ids of new tags on commit, load the window in use again on next
+    // use. The database stays locked until the queries got committed.
+    if (!m_changedTags.empty())
+      m_tagsStore->Reset();
+
     Clear();
 
     m_database->Unlock();
@@ -662,7 +677,10 @@ void CPVREpgTagsContainer::QueuePersistQuery()
 void CPVREpgTagsContainer::QueueDelete()
 {
   if (m_database)
+  {
     m_database->QueueDeleteEpgTags(m_iEpgID);
+    m_tagsStore->Clear();
+  }
 
   Clear();
 }
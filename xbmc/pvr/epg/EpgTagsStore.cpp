@@ -0,0 +1,636 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgTagsStore.h"
+
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
+#include "pvr/epg/EpgDatabase.h"
+#include "pvr/epg/EpgInfoTag.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+using namespace PVR;
+
+namespace
+{
+// loaded around the requested times, so scrolling the guide a bit doesn't hit the database
+constexpr time_t WINDOW_PADDING = 6 * 60 * 60;
+// the window grows up to this span, beyond it the tags outside the requested times get dropped
+constexpr time_t MAX_WINDOW_SPAN = 2 * 24 * 60 * 60;
+
+time_t ToTime(const CDateTime& dateTime)
+{
+  time_t t;
+  dateTime.GetAsTime(t);
+  return t;
+}
+
+time_t SubPadding(time_t t)
+{
+  constexpr time_t min = std::numeric_limits<time_t>::min();
+  return t > min + WINDOW_PADDING ? t - WINDOW_PADDING : min;
+}
+
+time_t AddPadding(time_t t)
+{
+  constexpr time_t max = std::numeric_limits<time_t>::max();
+  return t < max - WINDOW_PADDING ? t + WINDOW_PADDING : max;
+}
+} // unnamed namespace
+
+CPVREpgTagsStore::CStringPool::CStringPool()
+{
+  // id 0 is the empty string
+  m_strings.emplace_back();
+}
+
+CPVREpgTagsStore::StringId CPVREpgTagsStore::CStringPool::Intern(const std::string& str)
+{
+  if (str.empty())
+    return 0;
+
+  const auto it = m_ids.find(str);
+  if (it != m_ids.cend())
+    return it->second;
+
+  const auto id = static_cast<StringId>(m_strings.size());
+  m_ids.insert({m_strings.emplace_back(str), id});
+  return id;
+}
+
+CPVREpgTagsStore::CPVREpgTagsStore(int iEpgID, const std::shared_ptr<CPVREpgDatabase>& database)
+  : m_iEpgID(iEpgID), m_database(database), m_strings(std::make_unique<CStringPool>())
+{
+}
+
+void CPVREpgTagsStore::SetEpgID(int iEpgID)
+{
+  m_iEpgID = iEpgID;
+}
+
+void CPVREpgTagsStore::Clear()
+{
+  m_starts.clear();
+  m_ends.clear();
+  m_maxEnds.clear();
+  m_rows.clear();
+  m_strings = std::make_unique<CStringPool>();
+  m_iRemovedSinceCompact = 0;
+
+  // the database is about to be emptied, there is nothing to load anymore
+  m_bLoaded = true;
+  m_windowStart = std::numeric_limits<time_t>::min();
+  m_windowEnd = std::numeric_limits<time_t>::max();
+}
+
+void CPVREpgTagsStore::Reset()
+{
+  Clear();
+  m_bLoaded = false;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsStore::LoadTags(time_t minEnd,
+                                                                        time_t maxStart) const
+{
+  if (!m_database)
+    return {};
+
+  return m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, CDateTime(minEnd),
+                                                    CDateTime(maxStart));
+}
+
+bool CPVREpgTagsStore::IsInWindow(time_t t) const
+{
+  return m_bLoaded && m_windowStart <= t && t <= m_windowEnd;
+}
+
+void CPVREpgTagsStore::LoadWindow(time_t from, time_t to) const
+{
+  if (from > to)
+    std::swap(from, to);
+
+  if (IsInWindow(from) && IsInWindow(to))
+    return;
+
+  auto& store = const_cast<CPVREpgTagsStore&>(*this);
+
+  time_t start = SubPadding(from);
+  time_t end = AddPadding(to);
+
+  if (m_bLoaded)
+  {
+    const time_t unionStart = std::min(start, m_windowStart);
+    const time_t unionEnd = std::max(end, m_windowEnd);
+    if (unionEnd - MAX_WINDOW_SPAN <= unionStart)
+    {
+      start = unionStart;
+      end = unionEnd;
+    }
+    else if (end < m_windowStart || start > m_windowEnd)
+    {
+      store.Clear();
+      m_bLoaded = false;
+    }
+    else
+    {
+      store.EraseOutside(start, end);
+    }
+  }
+
+  if (!m_bLoaded)
+  {
+    store.Merge(LoadTags(start, end));
+  }
+  else
+  {
+    // only load the newly covered parts, tags crossing the old bounds are skipped by Merge
+    if (start < m_windowStart)
+      store.Merge(LoadTags(start, m_windowStart));
+    if (end > m_windowEnd)
+      store.Merge(LoadTags(m_windowEnd, end));
+  }
+
+  m_windowStart = start;
+  m_windowEnd = end;
+  m_bLoaded = true;
+}
+
+void CPVREpgTagsStore::Merge(const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags)
+{
+  if (tags.empty())
+    return;
+
+  // both sides are sorted by start time, merge them in one pass
+  std::vector<time_t> starts;
+  std::vector<time_t> ends;
+  std::vector<Row> rows;
+  starts.reserve(m_starts.size() + tags.size());
+  ends.reserve(m_starts.size() + tags.size());
+  rows.reserve(m_starts.size() + tags.size());
+
+  size_t i = 0;
+  const auto appendLoaded = [&, this]() {
+    starts.emplace_back(m_starts[i]);
+    ends.emplace_back(m_ends[i]);
+    rows.emplace_back(m_rows[i]);
+    ++i;
+  };
+
+  for (const auto& tag : tags)
+  {
+    const time_t start = ToTime(tag->StartAsUTC());
+    while (i < m_starts.size() && m_starts[i] < start)
+      appendLoaded();
+
+    // loaded already
+    if ((i < m_starts.size() && m_starts[i] == start) ||
+        (!starts.empty() && starts.back() >= start))
+      continue;
+
+    starts.emplace_back(start);
+    ends.emplace_back(ToTime(tag->EndAsUTC()));
+    rows.emplace_back(CreateRow(*tag));
+  }
+
+  while (i < m_starts.size())
+    appendLoaded();
+
+  m_starts = std::move(starts);
+  m_ends = std::move(ends);
+  m_rows = std::move(rows);
+  UpdateIndex(0);
+}
+
+void CPVREpgTagsStore::EraseOutside(time_t from, time_t to)
+{
+  std::vector<size_t> indexes;
+  for (size_t i = 0; i < m_rows.size(); ++i)
+  {
+    if (m_ends[i] < from || m_starts[i] > to)
+      indexes.emplace_back(i);
+  }
+
+  Erase(indexes);
+}
+
+void CPVREpgTagsStore::Insert(const CPVREpgInfoTag& tag)
+{
+  const time_t start = ToTime(tag.StartAsUTC());
+  LoadWindow(start, ToTime(tag.EndAsUTC()));
+
+  if (tag.DatabaseID() > 0)
+    RemoveByDatabaseID(tag.DatabaseID());
+
+  const auto it = std::lower_bound(m_starts.begin(), m_starts.end(), start);
+  const size_t index = static_cast<size_t>(std::distance(m_starts.begin(), it));
+
+  if (it != m_starts.end() && *it == start)
+  {
+    m_ends[index] = ToTime(tag.EndAsUTC());
+    m_rows[index] = CreateRow(tag);
+    m_iRemovedSinceCompact++;
+  }
+  else
+  {
+    m_starts.insert(it, start);
+    m_ends.insert(m_ends.begin() + index, ToTime(tag.EndAsUTC()));
+    m_rows.insert(m_rows.begin() + index, CreateRow(tag));
+  }
+
+  UpdateIndex(index);
+}
+
+void CPVREpgTagsStore::RemoveByDatabaseID(int iDatabaseID)
+{
+  if (iDatabaseID <= 0)
+    return;
+
+  const auto it = std::find_if(m_rows.cbegin(), m_rows.cend(), [iDatabaseID](const Row& row) {
+    return row.iDatabaseID == iDatabaseID;
+  });
+  if (it == m_rows.cend())
+    return;
+
+  const size_t index = static_cast<size_t>(std::distance(m_rows.cbegin(), it));
+  Erase({index});
+}
+
+void CPVREpgTagsStore::RemoveByMaxEndTime(const CDateTime& maxEnd)
+{
+  if (!m_bLoaded)
+    return;
+
+  const time_t t = ToTime(maxEnd);
+
+  std::vector<size_t> indexes;
+  for (size_t i = 0; i < m_ends.size(); ++i)
+  {
+    if (m_ends[i] < t)
+      indexes.emplace_back(i);
+  }
+
+  Erase(indexes);
+}
+
+void CPVREpgTagsStore::Erase(const std::vector<size_t>& indexes)
+{
+  if (indexes.empty())
+    return;
+
+  // compact all columns in one pass, indexes are sorted
+  size_t next = 0;
+  size_t to = indexes.front();
+  for (size_t from = indexes.front(); from < m_rows.size(); ++from)
+  {
+    if (next < indexes.size() && indexes[next] == from)
+    {
+      ++next;
+      continue;
+    }
+
+    m_starts[to] = m_starts[from];
+    m_ends[to] = m_ends[from];
+    m_rows[to] = m_rows[from];
+    ++to;
+  }
+
+  m_starts.resize(to);
+  m_ends.resize(to);
+  m_rows.resize(to);
+
+  m_iRemovedSinceCompact += indexes.size();
+  if (m_iRemovedSinceCompact > m_rows.size())
+    CompactStrings();
+
+  UpdateIndex(indexes.front());
+}
+
+void CPVREpgTagsStore::UpdateIndex(size_t first) const
+{
+  m_maxEnds.resize(m_ends.size());
+  for (size_t i = first; i < m_ends.size(); ++i)
+    m_maxEnds[i] = i > 0 ? std::max(m_maxEnds[i - 1], m_ends[i]) : m_ends[i];
+}
+
+void CPVREpgTagsStore::CompactStrings()
+{
+  // strings of removed and replaced tags stay in the pool until it gets rebuilt
+  auto strings = std::make_unique<CStringPool>();
+  for (auto& row : m_rows)
+  {
+    for (StringId* id :
+         {&row.title, &row.plotOutline, &row.plot, &row.originalTitle, &row.cast, &row.directors,
+          &row.writers, &row.imdbNumber, &row.iconPath, &row.genreDescription, &row.firstAired,
+          &row.episodeName, &row.seriesLink, &row.parentalRatingCode, &row.parentalRatingIcon,
+          &row.parentalRatingSource})
+      *id = strings->Intern(m_strings->Get(*id));
+  }
+
+  m_strings = std::move(strings);
+  m_iRemovedSinceCompact = 0;
+}
+
+CPVREpgTagsStore::Row CPVREpgTagsStore::CreateRow(const CPVREpgInfoTag& tag)
+{
+  Row row;
+  row.iDatabaseID = tag.DatabaseID();
+  row.iUniqueBroadcastID = tag.UniqueBroadcastID();
+  row.iFlags = tag.Flags();
+  row.iParentalRating = tag.ParentalRating();
+  row.iGenreType = tag.GenreType();
+  row.iGenreSubType = tag.GenreSubType();
+  row.iStarRating = tag.StarRating();
+  row.iSeriesNumber = tag.SeriesNumber();
+  row.iEpisodeNumber = tag.EpisodeNumber();
+  row.iEpisodePart = tag.EpisodePart();
+  row.iYear = tag.Year();
+  row.title = m_strings->Intern(tag.Title());
+  row.plotOutline = m_strings->Intern(tag.PlotOutline());
+  row.plot = m_strings->Intern(tag.Plot());
+  row.originalTitle = m_strings->Intern(tag.OriginalTitle());
+  row.cast = m_strings->Intern(CPVREpgInfoTag::DeTokenize(tag.Cast()));
+  row.directors = m_strings->Intern(CPVREpgInfoTag::DeTokenize(tag.Directors()));
+  row.writers = m_strings->Intern(CPVREpgInfoTag::DeTokenize(tag.Writers()));
+  row.imdbNumber = m_strings->Intern(tag.IMDBNumber());
+  row.iconPath = m_strings->Intern(tag.ClientIconPath());
+  row.genreDescription = m_strings->Intern(tag.GenreDescription());
+  row.firstAired =
+      m_strings->Intern(tag.FirstAired().IsValid() ? tag.FirstAired().GetAsW3CDate() : "");
+  row.episodeName = m_strings->Intern(tag.EpisodeName());
+  row.seriesLink = m_strings->Intern(tag.SeriesLink());
+  row.parentalRatingCode = m_strings->Intern(tag.ParentalRatingCode());
+  row.parentalRatingIcon = m_strings->Intern(tag.ParentalRatingIcon());
+  row.parentalRatingSource = m_strings->Intern(tag.ParentalRatingSource());
+  return row;
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::CreateTag(size_t index) const
+{
+  const Row& row = m_rows[index];
+
+  // same as CPVREpgDatabase::CreateEpgTag does for a database row
+  std::shared_ptr<CPVREpgInfoTag> tag(
+      new CPVREpgInfoTag(m_iEpgID, m_strings->Get(row.iconPath)));
+
+  tag->m_startTime = CDateTime(m_starts[index]);
+  tag->m_endTime = CDateTime(m_ends[index]);
+
+  const std::string& firstAired = m_strings->Get(row.firstAired);
+  if (!firstAired.empty())
+    tag->m_firstAired.SetFromW3CDate(firstAired);
+
+  tag->m_iUniqueBroadcastID = row.iUniqueBroadcastID;
+  tag->m_iDatabaseID = row.iDatabaseID;
+  tag->m_strTitle = m_strings->Get(row.title);
+  tag->m_strPlotOutline = m_strings->Get(row.plotOutline);
+  tag->m_strPlot = m_strings->Get(row.plot);
+  tag->m_strOriginalTitle = m_strings->Get(row.originalTitle);
+  tag->m_cast = CPVREpgInfoTag::Tokenize(m_strings->Get(row.cast));
+  tag->m_directors = CPVREpgInfoTag::Tokenize(m_strings->Get(row.directors));
+  tag->m_writers = CPVREpgInfoTag::Tokenize(m_strings->Get(row.writers));
+  tag->m_iYear = row.iYear;
+  tag->m_strIMDBNumber = m_strings->Get(row.imdbNumber);
+  tag->m_parentalRating = row.iParentalRating;
+  tag->m_iStarRating = row.iStarRating;
+  tag->m_iEpisodeNumber = row.iEpisodeNumber;
+  tag->m_iEpisodePart = row.iEpisodePart;
+  tag->m_strEpisodeName = m_strings->Get(row.episodeName);
+  tag->m_iSeriesNumber = row.iSeriesNumber;
+  tag->m_iFlags = row.iFlags;
+  tag->m_strSeriesLink = m_strings->Get(row.seriesLink);
+  tag->m_parentalRatingCode = m_strings->Get(row.parentalRatingCode);
+  tag->m_parentalRatingIcon = m_strings->Get(row.parentalRatingIcon);
+  tag->m_parentalRatingSource = m_strings->Get(row.parentalRatingSource);
+  tag->m_iGenreType = row.iGenreType;
+  tag->m_iGenreSubType = row.iGenreSubType;
+  tag->m_strGenreDescription = m_strings->Get(row.genreDescription);
+  return tag;
+}
+
+bool CPVREpgTagsStore::HasTags() const
+{
+  if (!m_rows.empty() || !m_database)
+    return !m_rows.empty();
+
+  return m_database->HasTags(m_iEpgID);
+}
+
+size_t CPVREpgTagsStore::GetSize() const
+{
+  return m_rows.size();
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::GetTagByStartTime(
+    const CDateTime& startTime) const
+{
+  const time_t t = ToTime(startTime);
+  if (!IsInWindow(t) && m_database)
+    return m_database->GetEpgTagByStartTime(m_iEpgID, startTime);
+
+  const auto it = std::lower_bound(m_starts.cbegin(), m_starts.cend(), t);
+  if (it == m_starts.cend() || *it != t)
+    return {};
+
+  return CreateTag(static_cast<size_t>(std::distance(m_starts.cbegin(), it)));
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::GetTagByUniqueBroadcastID(
+    unsigned int iUniqueBroadcastID) const
+{
+  if (iUniqueBroadcastID == EPG_TAG_INVALID_UID)
+    return {};
+
+  const auto it =
+      std::find_if(m_rows.cbegin(), m_rows.cend(), [iUniqueBroadcastID](const Row& row) {
+        return row.iUniqueBroadcastID == iUniqueBroadcastID;
+      });
+  if (it == m_rows.cend())
+  {
+    if (m_database)
+      return m_database->GetEpgTagByUniqueBroadcastID(m_iEpgID, iUniqueBroadcastID);
+
+    return {};
+  }
+
+  return CreateTag(static_cast<size_t>(std::distance(m_rows.cbegin(), it)));
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::GetTagByDatabaseID(int iDatabaseID) const
+{
+  if (iDatabaseID <= 0)
+    return {};
+
+  const auto it = std::find_if(m_rows.cbegin(), m_rows.cend(), [iDatabaseID](const Row& row) {
+    return row.iDatabaseID == iDatabaseID;
+  });
+  if (it == m_rows.cend())
+  {
+    if (m_database)
+      return m_database->GetEpgTagByDatabaseID(m_iEpgID, iDatabaseID);
+
+    return {};
+  }
+
+  return CreateTag(static_cast<size_t>(std::distance(m_rows.cbegin(), it)));
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::GetTagByMinStartTime(
+    const CDateTime& minStart) const
+{
+  const time_t t = ToTime(minStart);
+
+  // all tags starting between t and the end of the window are loaded
+  const auto it = std::lower_bound(m_starts.cbegin(), m_starts.cend(), t);
+  if (!m_database || (IsInWindow(t) && it != m_starts.cend() && *it <= m_windowEnd))
+  {
+    if (it == m_starts.cend())
+      return {};
+
+    return CreateTag(static_cast<size_t>(std::distance(m_starts.cbegin(), it)));
+  }
+
+  return m_database->GetEpgTagByMinStartTime(m_iEpgID, minStart);
+}
+
+std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsStore::GetTagByMaxEndTime(const CDateTime& maxEnd) const
+{
+  const time_t t = ToTime(maxEnd);
+
+  // tags can't end before they start, only tags starting up to t qualify. All tags starting
+  // between the start of the window and t are loaded.
+  const auto it = std::upper_bound(m_starts.cbegin(), m_starts.cend(), t);
+  for (size_t i = static_cast<size_t>(std::distance(m_starts.cbegin(), it)); i > 0; --i)
+  {
+    if (m_ends[i - 1] <= t)
+    {
+      if (!m_database || (IsInWindow(t) && m_starts[i - 1] >= m_windowStart))
+        return CreateTag(i - 1);
+
+      break;
+    }
+  }
+
+  if (m_database)
+    return m_database->GetEpgTagByMaxEndTime(m_iEpgID, maxEnd);
+
+  return {};
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsStore::GetTagsByMinStartMaxEndTime(
+    const CDateTime& minStart, const CDateTime& maxEnd) const
+{
+  const time_t tMinStart = ToTime(minStart);
+  const time_t tMaxEnd = ToTime(maxEnd);
+  LoadWindow(tMinStart, tMaxEnd);
+
+  const auto first = std::lower_bound(m_starts.cbegin(), m_starts.cend(), tMinStart);
+  const auto last = std::upper_bound(first, m_starts.cend(), tMaxEnd);
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (auto i = static_cast<size_t>(std::distance(m_starts.cbegin(), first));
+       i < static_cast<size_t>(std::distance(m_starts.cbegin(), last)); ++i)
+  {
+    if (m_ends[i] <= tMaxEnd)
+      tags.emplace_back(CreateTag(i));
+  }
+  return tags;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsStore::GetTagsByMinEndMaxStartTime(
+    const CDateTime& minEnd, const CDateTime& maxStart) const
+{
+  const time_t tMinEnd = ToTime(minEnd);
+  const time_t tMaxStart = ToTime(maxStart);
+  LoadWindow(tMinEnd, tMaxStart);
+
+  // no tag before the first one with a running max end >= minEnd can end late enough
+  const auto first = std::lower_bound(m_maxEnds.cbegin(), m_maxEnds.cend(), tMinEnd);
+  const auto last = std::upper_bound(m_starts.cbegin(), m_starts.cend(), tMaxStart);
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  for (auto i = static_cast<size_t>(std::distance(m_maxEnds.cbegin(), first));
+       i < static_cast<size_t>(std::distance(m_starts.cbegin(), last)); ++i)
+  {
+    if (m_ends[i] >= tMinEnd)
+      tags.emplace_back(CreateTag(i));
+  }
+  return tags;
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsStore::GetAllTags() const
+{
+  // don't load everything, the window stays bounded
+  if (m_database)
+    return m_database->GetAllEpgTags(m_iEpgID);
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  tags.reserve(m_rows.size());
+  for (size_t i = 0; i < m_rows.size(); ++i)
+    tags.emplace_back(CreateTag(i));
+  return tags;
+}
+
+CDateTime CPVREpgTagsStore::GetLastEndTime() const
+{
+  if (m_database)
+    return m_database->GetLastEndTime(m_iEpgID);
+
+  if (m_maxEnds.empty())
+    return {};
+
+  return CDateTime(m_maxEnds.back());
+}
+
+CDateTime CPVREpgTagsStore::GetMinStartTime(const CDateTime& minStart) const
+{
+  const time_t t = ToTime(minStart);
+
+  // all tags starting between t and the end of the window are loaded
+  const auto it = std::upper_bound(m_starts.cbegin(), m_starts.cend(), t);
+  if (!m_database || (IsInWindow(t) && it != m_starts.cend() && *it <= m_windowEnd))
+  {
+    if (it == m_starts.cend())
+      return {};
+
+    return CDateTime(*it);
+  }
+
+  return m_database->GetMinStartTime(m_iEpgID, minStart);
+}
+
+CDateTime CPVREpgTagsStore::GetMaxEndTime(const CDateTime& maxEnd) const
+{
+  const time_t t = ToTime(maxEnd);
+
+  bool bFound = false;
+  time_t result = 0;
+  const auto it = std::upper_bound(m_starts.cbegin(), m_starts.cend(), t);
+  for (size_t i = static_cast<size_t>(std::distance(m_starts.cbegin(), it)); i > 0; --i)
+  {
+    // no tag before this one ends later than the running max end
+    if (bFound && m_maxEnds[i - 1] <= result)
+      break;
+
+    if (m_ends[i - 1] <= t && (!bFound || m_ends[i - 1] > result))
+    {
+      result = m_ends[i - 1];
+      bFound = true;
+    }
+  }
+
+  // all tags ending between the start of the window and t are loaded
+  if (m_database && !(IsInWindow(t) && bFound && result >= m_windowStart))
+    return m_database->GetMaxEndTime(m_iEpgID, maxEnd);
+
+  if (!bFound)
+    return {};
+
+  return CDateTime(result);
+}
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "XBDateTime.h"
+
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PVR
+{
+class CPVREpgDatabase;
+class CPVREpgInfoTag;
+
+/*!
+ * @brief Compact in-memory copy of the persisted EPG tags of one EPG around the times in use.
+ *
+ * The store loads the tags of the time window the guide asks for from the database, so
+ * lookups and time range queries within that window don't hit the database anymore. The
+ * window grows with adjacent queries, only the newly covered part gets loaded. Once it would
+ * span more than a few days, the tags outside of the new window are dropped, thus the memory
+ * used per EPG stays bounded no matter how many days of guide data got persisted. Lookups
+ * outside of the window go to the database without loading anything.
+ *
+ * Deletions are applied to the loaded tags, persisting changed tags drops them instead, as the
+ * database assigns the ids of new tags on commit. Start and end times are kept in columns of
+ * their own, together with the running maximum of the end times they form an interval
+ * index for time range queries. All other data is kept in fixed size rows with
+ * the strings interned, repeated titles, genres and series links of a channel
+ * are stored only once.
+ *
+ * CPVREpgInfoTag instances are created on demand for the tags a query returns.
+ * They are copies, changing them doesn't change the store.
+ *
+ * The store isn't thread safe, the owning EPG serializes access. Loading takes
+ * the database lock, thus it waits for pending commits of the EPG.
+ */
+class CPVREpgTagsStore
+{
+public:
+  CPVREpgTagsStore() = delete;
+  CPVREpgTagsStore(int iEpgID, const std::shared_ptr<CPVREpgDatabase>& database);
+  CPVREpgTagsStore(CPVREpgTagsStore&&) = default;
+  virtual ~CPVREpgTagsStore() = default;
+
+  /*!
+   * @brief Set the EPG id of the tags.
+   * @param iEpgID The ID.
+   */
+  void SetEpgID(int iEpgID);
+
+  /*!
+   * @brief Check whether the tags of a time window were loaded from the database already.
+   * @return True if loaded, false otherwise.
+   */
+  bool IsLoaded() const { return m_bLoaded; }
+
+  /*!
+   * @brief Drop all tags. The store is considered loaded afterwards, as the
+   * database is about to be emptied too.
+   */
+  void Clear();
+
+  /*!
+   * @brief Drop all tags and load the ones of the window in use from the database again on
+   * next use.
+   */
+  void Reset();
+
+  /*!
+   * @brief Add a tag, replacing the ones with the same start time or database id.
+   * @param tag The tag.
+   */
+  void Insert(const CPVREpgInfoTag& tag);
+
+  /*!
+   * @brief Remove the tag with the given database id.
+   * @param iDatabaseID The ID.
+   */
+  void RemoveByDatabaseID(int iDatabaseID);
+
+  /*!
+   * @brief Remove all tags with an end time before the given time.
+   */
+  void RemoveByMaxEndTime(const CDateTime& maxEnd);
+
+  bool HasTags() const;
+
+  std::shared_ptr<CPVREpgInfoTag> GetTagByStartTime(const CDateTime& startTime) const;
+  std::shared_ptr<CPVREpgInfoTag> GetTagByUniqueBroadcastID(unsigned int iUniqueBroadcastID) const;
+  std::shared_ptr<CPVREpgInfoTag> GetTagByDatabaseID(int iDatabaseID) const;
+
+  /*!
+   * @brief Get the first tag starting at or after the given time.
+   */
+  std::shared_ptr<CPVREpgInfoTag> GetTagByMinStartTime(const CDateTime& minStart) const;
+
+  /*!
+   * @brief Get the last starting tag that ends at or before the given time.
+   */
+  std::shared_ptr<CPVREpgInfoTag> GetTagByMaxEndTime(const CDateTime& maxEnd) const;
+
+  /*!
+   * @brief Get the tags starting at or after minStart and ending at or before maxEnd.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinStartMaxEndTime(
+      const CDateTime& minStart, const CDateTime& maxEnd) const;
+
+  /*!
+   * @brief Get the tags ending at or after minEnd and starting at or before maxStart.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsByMinEndMaxStartTime(
+      const CDateTime& minEnd, const CDateTime& maxStart) const;
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAllTags() const;
+
+  /*!
+   * @brief Get the latest end time of all tags.
+   */
+  CDateTime GetLastEndTime() const;
+
+  /*!
+   * @brief Get the earliest start time after the given time.
+   */
+  CDateTime GetMinStartTime(const CDateTime& minStart) const;
+
+  /*!
+   * @brief Get the latest end time at or before the given time.
+   */
+  CDateTime GetMaxEndTime(const CDateTime& maxEnd) const;
+
+  /*!
+   * @brief Get the number of loaded tags.
+   */
+  size_t GetSize() const;
+
+protected:
+  /*!
+   * @brief Load the persisted tags ending at or after minEnd and starting at or before maxStart.
+   * @return The tags, sorted by start time.
+   */
+  virtual std::vector<std::shared_ptr<CPVREpgInfoTag>> LoadTags(time_t minEnd,
+                                                                time_t maxStart) const;
+
+private:
+  using StringId = uint32_t;
+
+  struct Row
+  {
+    int iDatabaseID;
+    unsigned int iUniqueBroadcastID;
+    unsigned int iFlags;
+    unsigned int iParentalRating;
+    int iGenreType;
+    int iGenreSubType;
+    int iStarRating;
+    int iSeriesNumber;
+    int iEpisodeNumber;
+    int iEpisodePart;
+    int iYear;
+    StringId title;
+    StringId plotOutline;
+    StringId plot;
+    StringId originalTitle;
+    StringId cast;
+    StringId directors;
+    StringId writers;
+    StringId imdbNumber;
+    StringId iconPath;
+    StringId genreDescription;
+    StringId firstAired;
+    StringId episodeName;
+    StringId seriesLink;
+    StringId parentalRatingCode;
+    StringId parentalRatingIcon;
+    StringId parentalRatingSource;
+  };
+
+  class CStringPool
+  {
+  public:
+    CStringPool();
+    StringId Intern(const std::string& str);
+    const std::string& Get(StringId id) const { return m_strings[id]; }
+    size_t GetSize() const { return m_strings.size(); }
+
+  private:
+    std::deque<std::string> m_strings; // a deque doesn't move its elements, the views stay valid
+    std::unordered_map<std::string_view, StringId> m_ids;
+  };
+
+  bool IsInWindow(time_t t) const;
+  void LoadWindow(time_t from, time_t to) const;
+  void Merge(const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags);
+  void EraseOutside(time_t from, time_t to);
+  void Erase(const std::vector<size_t>& indexes);
+  void UpdateIndex(size_t first) const;
+  void CompactStrings();
+
+  Row CreateRow(const CPVREpgInfoTag& tag);
+  std::shared_ptr<CPVREpgInfoTag> CreateTag(size_t index) const;
+
+  int m_iEpgID = -1;
+  const std::shared_ptr<CPVREpgDatabase> m_database;
+
+  mutable bool m_bLoaded = false;
+  mutable time_t m_windowStart = 0; // all tags overlapping [m_windowStart, m_windowEnd] are loaded
+  mutable time_t m_windowEnd = 0;
+  mutable std::vector<time_t> m_starts; // sorted, unique
+  mutable std::vector<time_t> m_ends;
+  mutable std::vector<time_t> m_maxEnds; // m_maxEnds[i] = max(m_ends[0..i])
+  mutable std::vector<Row> m_rows;
+  mutable std::unique_ptr<CStringPool> m_strings;
+  size_t m_iRemovedSinceCompact = 0;
+};
+
+} // namespace PVR
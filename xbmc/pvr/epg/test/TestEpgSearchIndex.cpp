@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "pvr/epg/EpgSearchIndex.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+using Terms = std::vector<std::vector<std::string>>;
+using Keys = std::vector<CPVREpgSearchIndex::TagKey>;
+
+CPVREpgSearchIndex CreateIndex()
+{
+  CPVREpgSearchIndex index;
+  index.Add(1, 0, 100, "Football Tonight", "", "Live from the stadium.");
+  index.Add(1, 100, 200, "The News", "Headlines", "");
+  index.Add(2, 0, 50, "Cooking", "Quick recipes", "Today: FOOTBALL snacks");
+  index.SetLoaded(true);
+  return index;
+}
+} // namespace
+
+TEST(TestEpgSearchIndex, Substrings)
+{
+  const CPVREpgSearchIndex index = CreateIndex();
+
+  Keys candidates;
+  ASSERT_TRUE(index.GetCandidates(Terms{{"BALL"}}, false, candidates));
+  EXPECT_EQ((Keys{{1, 0}}), candidates);
+
+  // plot words count only when searching the plot
+  candidates.clear();
+  ASSERT_TRUE(index.GetCandidates(Terms{{"ball"}}, true, candidates));
+  EXPECT_EQ((Keys{{1, 0}, {2, 0}}), candidates);
+
+  // terms spanning words match by their longest fragment
+  candidates.clear();
+  ASSERT_TRUE(index.GetCandidates(Terms{{"e new"}}, false, candidates));
+  EXPECT_EQ((Keys{{1, 100}}), candidates);
+
+  candidates.clear();
+  ASSERT_TRUE(index.GetCandidates(Terms{{"weather"}}, true, candidates));
+  EXPECT_TRUE(candidates.empty());
+
+  // too short to narrow down anything
+  EXPECT_FALSE(index.GetCandidates(Terms{{"a"}}, true, candidates));
+  EXPECT_FALSE(index.GetCandidates(Terms{}, true, candidates));
+}
+
+TEST(TestEpgSearchIndex, TermGroups)
+{
+  const CPVREpgSearchIndex index = CreateIndex();
+
+  // all terms of a group must match
+  Keys candidates;
+  ASSERT_TRUE(index.GetCandidates(Terms{{"football", "stadium"}}, true, candidates));
+  EXPECT_EQ((Keys{{1, 0}}), candidates);
+
+  // any of the groups
+  candidates.clear();
+  ASSERT_TRUE(index.GetCandidates(Terms{{"news"}, {"cook"}}, false, candidates));
+  EXPECT_EQ((Keys{{1, 100}, {2, 0}}), candidates);
+
+  // a group without a usable term could match anything
+  candidates.clear();
+  EXPECT_FALSE(index.GetCandidates(Terms{{"news"}, {"x"}}, false, candidates));
+}
+
+TEST(TestEpgSearchIndex, Modify)
+{
+  CPVREpgSearchIndex index = CreateIndex();
+
+  // persisting drops the overlapped tags of the same EPG
+  index.Replace(1, 50, 150, "Movie", "", "");
+  EXPECT_EQ(2u, index.GetSize());
+
+  Keys candidates;
+  ASSERT_TRUE(index.GetCandidates(Terms{{"football"}, {"news"}, {"movie"}}, false, candidates));
+  EXPECT_EQ((Keys{{1, 50}}), candidates);
+
+  index.RemoveByMaxEndTime(2, 51);
+  EXPECT_EQ(1u, index.GetSize());
+
+  index.Remove(1);
+  EXPECT_EQ(0u, index.GetSize());
+
+  candidates.clear();
+  ASSERT_TRUE(index.GetCandidates(Terms{{"movie"}}, true, candidates));
+  EXPECT_TRUE(candidates.empty());
+}
@@ -0,0 +1,272 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XBDateTime.h"
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
+#include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgTagsStore.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr int EPG_ID = 1;
+constexpr time_t BASE = 1700000000;
+
+CDateTime Time(time_t offset)
+{
+  return CDateTime(BASE + offset);
+}
+
+std::shared_ptr<CPVREpgInfoTag> CreateTag(time_t start,
+                                          time_t end,
+                                          const char* title,
+                                          unsigned int uid = EPG_TAG_INVALID_UID)
+{
+  EPG_TAG data{};
+  data.iUniqueBroadcastId = uid;
+  data.startTime = BASE + start;
+  data.endTime = BASE + end;
+  data.strTitle = title;
+  return std::make_shared<CPVREpgInfoTag>(data, 0, nullptr, EPG_ID);
+}
+
+CPVREpgTagsStore CreateStore()
+{
+  // no database, the store starts empty
+  CPVREpgTagsStore store(EPG_ID, nullptr);
+  store.Insert(*CreateTag(0, 100, "a", 1));
+  store.Insert(*CreateTag(100, 200, "b", 2));
+  store.Insert(*CreateTag(150, 400, "c", 3)); // overlaps b
+  store.Insert(*CreateTag(500, 600, "d", 4));
+  return store;
+}
+
+constexpr time_t ONE_HOUR = 60 * 60;
+
+// stands in for the database, persisted tags are hourly for 40 days
+class CTestEpgTagsStore : public CPVREpgTagsStore
+{
+public:
+  CTestEpgTagsStore() : CPVREpgTagsStore(EPG_ID, nullptr)
+  {
+    for (time_t start = 0; start < 40 * 24 * ONE_HOUR; start += ONE_HOUR)
+      m_persisted.emplace_back(::CreateTag(start, start + ONE_HOUR, "tag"));
+  }
+
+  mutable std::vector<std::pair<time_t, time_t>> m_loads;
+
+protected:
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> LoadTags(time_t minEnd,
+                                                        time_t maxStart) const override
+  {
+    m_loads.emplace_back(minEnd - BASE, maxStart - BASE);
+
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    for (const auto& tag : m_persisted)
+    {
+      if (tag->EndAsUTC() >= CDateTime(minEnd) && tag->StartAsUTC() <= CDateTime(maxStart))
+        tags.emplace_back(tag);
+    }
+    return tags;
+  }
+
+private:
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> m_persisted;
+};
+} // namespace
+
+TEST(TestEpgTagsStore, RoundTrip)
+{
+  EPG_TAG data{};
+  data.iUniqueBroadcastId = 42;
+  data.startTime = BASE;
+  data.endTime = BASE + 3600;
+  data.strTitle = "Title";
+  data.strPlotOutline = "Outline";
+  data.strPlot = "Plot";
+  data.strCast = "Actor 1,Actor 2";
+  data.strEpisodeName = "Pilot";
+  data.strFirstAired = "2020-05-01";
+  data.strSeriesLink = "series";
+  data.iGenreType = EPG_EVENT_CONTENTMASK_MOVIEDRAMA;
+  data.iSeriesNumber = 3;
+  data.iEpisodeNumber = 7;
+  data.iYear = 2020;
+  const CPVREpgInfoTag tag(data, 0, nullptr, EPG_ID);
+
+  CPVREpgTagsStore store(EPG_ID, nullptr);
+  store.Insert(tag);
+
+  const auto result = store.GetTagByStartTime(Time(0));
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(tag.StartAsUTC(), result->StartAsUTC());
+  EXPECT_EQ(tag.EndAsUTC(), result->EndAsUTC());
+  EXPECT_EQ(42u, result->UniqueBroadcastID());
+  EXPECT_EQ("Title", result->Title());
+  EXPECT_EQ("Outline", result->PlotOutline());
+  EXPECT_EQ("Plot", result->Plot());
+  EXPECT_EQ(tag.Cast(), result->Cast());
+  EXPECT_EQ("Pilot", result->EpisodeName());
+  EXPECT_EQ(tag.FirstAired(), result->FirstAired());
+  EXPECT_EQ("series", result->SeriesLink());
+  EXPECT_EQ(EPG_EVENT_CONTENTMASK_MOVIEDRAMA, result->GenreType());
+  EXPECT_EQ(3, result->SeriesNumber());
+  EXPECT_EQ(7, result->EpisodeNumber());
+  EXPECT_EQ(2020, result->Year());
+  EXPECT_EQ(EPG_ID, result->EpgID());
+
+  EXPECT_EQ(nullptr, store.GetTagByStartTime(Time(1)));
+  EXPECT_NE(nullptr, store.GetTagByUniqueBroadcastID(42));
+  EXPECT_EQ(nullptr, store.GetTagByUniqueBroadcastID(43));
+}
+
+TEST(TestEpgTagsStore, MinEndMaxStartTime)
+{
+  const CPVREpgTagsStore store = CreateStore();
+
+  // everything running at some point in [120, 160]
+  auto tags = store.GetTagsByMinEndMaxStartTime(Time(120), Time(160));
+  ASSERT_EQ(2u, tags.size());
+  EXPECT_EQ("b", tags[0]->Title());
+  EXPECT_EQ("c", tags[1]->Title());
+
+  // c ends after d starts, the interval index must not stop at b
+  tags = store.GetTagsByMinEndMaxStartTime(Time(300), Time(550));
+  ASSERT_EQ(2u, tags.size());
+  EXPECT_EQ("c", tags[0]->Title());
+  EXPECT_EQ("d", tags[1]->Title());
+
+  EXPECT_TRUE(store.GetTagsByMinEndMaxStartTime(Time(601), Time(700)).empty());
+}
+
+TEST(TestEpgTagsStore, MinStartMaxEndTime)
+{
+  const CPVREpgTagsStore store = CreateStore();
+
+  auto tags = store.GetTagsByMinStartMaxEndTime(Time(100), Time(300));
+  ASSERT_EQ(1u, tags.size());
+  EXPECT_EQ("b", tags[0]->Title());
+
+  tags = store.GetTagsByMinStartMaxEndTime(Time(0), Time(1000));
+  EXPECT_EQ(4u, tags.size());
+}
+
+TEST(TestEpgTagsStore, NeighbourTags)
+{
+  const CPVREpgTagsStore store = CreateStore();
+
+  auto tag = store.GetTagByMaxEndTime(Time(450));
+  ASSERT_NE(nullptr, tag);
+  EXPECT_EQ("c", tag->Title());
+
+  tag = store.GetTagByMaxEndTime(Time(250));
+  ASSERT_NE(nullptr, tag);
+  EXPECT_EQ("b", tag->Title());
+
+  EXPECT_EQ(nullptr, store.GetTagByMaxEndTime(Time(50)));
+
+  tag = store.GetTagByMinStartTime(Time(101));
+  ASSERT_NE(nullptr, tag);
+  EXPECT_EQ("c", tag->Title());
+
+  EXPECT_EQ(Time(600), store.GetLastEndTime());
+  EXPECT_EQ(Time(400), store.GetMaxEndTime(Time(450)));
+  EXPECT_EQ(Time(200), store.GetMaxEndTime(Time(399)));
+  EXPECT_FALSE(store.GetMaxEndTime(Time(99)).IsValid());
+  EXPECT_EQ(Time(500), store.GetMinStartTime(Time(150)));
+  EXPECT_FALSE(store.GetMinStartTime(Time(500)).IsValid());
+}
+
+TEST(TestEpgTagsStore, Modify)
+{
+  CPVREpgTagsStore store = CreateStore();
+
+  // same start time replaces the tag
+  store.Insert(*CreateTag(150, 450, "e"));
+  EXPECT_EQ(4u, store.GetSize());
+  EXPECT_EQ("e", store.GetTagByStartTime(Time(150))->Title());
+  EXPECT_EQ(Time(450), store.GetMaxEndTime(Time(499)));
+
+  // removing more tags than are left rebuilds the strings
+  store.RemoveByMaxEndTime(Time(201));
+  EXPECT_EQ(2u, store.GetSize());
+  EXPECT_EQ(nullptr, store.GetTagByStartTime(Time(0)));
+  EXPECT_EQ(nullptr, store.GetTagByMaxEndTime(Time(300)));
+  EXPECT_EQ("d", store.GetTagByStartTime(Time(500))->Title());
+
+  store.RemoveByMaxEndTime(Time(451));
+  ASSERT_EQ(1u, store.GetSize());
+  EXPECT_EQ("d", store.GetTagByStartTime(Time(500))->Title());
+  EXPECT_EQ(4u, store.GetTagByStartTime(Time(500))->UniqueBroadcastID());
+
+  store.Clear();
+  EXPECT_FALSE(store.HasTags());
+  EXPECT_FALSE(store.GetLastEndTime().IsValid());
+}
+
+TEST(TestEpgTagsStore, LoadWindow)
+{
+  const CTestEpgTagsStore store;
+
+  auto tags = store.GetTagsByMinEndMaxStartTime(Time(10 * ONE_HOUR), Time(12 * ONE_HOUR));
+  ASSERT_EQ(4u, tags.size());
+  EXPECT_EQ(Time(9 * ONE_HOUR), tags.front()->StartAsUTC());
+  ASSERT_EQ(1u, store.m_loads.size());
+
+  // only the padded window got loaded, not all 960 persisted tags
+  const size_t loaded = store.GetSize();
+  EXPECT_LT(loaded, 20u);
+
+  // queries within the window don't load again
+  EXPECT_NE(nullptr, store.GetTagByStartTime(Time(14 * ONE_HOUR)));
+  EXPECT_EQ(Time(15 * ONE_HOUR), store.GetMinStartTime(Time(14 * ONE_HOUR)));
+  EXPECT_EQ(Time(14 * ONE_HOUR), store.GetMaxEndTime(Time(14 * ONE_HOUR)));
+  EXPECT_EQ(1u, store.m_loads.size());
+
+  // scrolling on only loads the newly covered part
+  const time_t windowEnd = store.m_loads.front().second;
+  tags = store.GetTagsByMinEndMaxStartTime(Time(20 * ONE_HOUR), Time(22 * ONE_HOUR));
+  EXPECT_EQ(4u, tags.size());
+  ASSERT_EQ(2u, store.m_loads.size());
+  EXPECT_EQ(windowEnd, store.m_loads.back().first);
+
+  // tags crossing the old bound aren't loaded twice
+  tags = store.GetTagsByMinStartMaxEndTime(Time(0), Time(30 * ONE_HOUR));
+  for (size_t i = 1; i < tags.size(); ++i)
+    EXPECT_EQ(tags[i - 1]->EndAsUTC(), tags[i]->StartAsUTC());
+
+  // jumping days ahead drops what was loaded before, the store stays bounded
+  tags = store.GetTagsByMinEndMaxStartTime(Time(30 * 24 * ONE_HOUR), Time(31 * 24 * ONE_HOUR));
+  EXPECT_EQ(26u, tags.size());
+  EXPECT_LT(store.GetSize(), 40u);
+  EXPECT_EQ(nullptr, store.GetTagByStartTime(Time(14 * ONE_HOUR)));
+}
+
+TEST(TestEpgTagsStore, ResetLoadsWindowOnly)
+{
+  CTestEpgTagsStore store;
+
+  store.GetTagsByMinEndMaxStartTime(Time(10 * ONE_HOUR), Time(12 * ONE_HOUR));
+  const size_t loaded = store.GetSize();
+
+  store.Reset();
+  EXPECT_FALSE(store.IsLoaded());
+  EXPECT_EQ(0u, store.GetSize());
+
+  store.GetTagsByMinEndMaxStartTime(Time(10 * ONE_HOUR), Time(12 * ONE_HOUR));
+  EXPECT_EQ(loaded, store.GetSize());
+  ASSERT_EQ(2u, store.m_loads.size());
+  EXPECT_EQ(store.m_loads.front(), store.m_loads.back());
+}
@@ -334,6 +334,32 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetEpgTagsAfter(EpgTags& e
   return result;
 }
 
+bool CGUIEPGGridContainerModel::TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const
+{
+  auto& tags = epgTags.tags;
+
+  // tags are sorted, drop the ones ending before the first and starting after the last block
+  const auto first = std::find_if(tags.cbegin(), tags.cend(), [this, firstBlock](const auto& item) {
+    return GetLastEventBlock(item->GetEPGInfoTag()) >= firstBlock;
+  });
+  tags.erase(tags.cbegin(), first);
+
+  const auto last =
+      std::find_if(tags.crbegin(), tags.crend(), [this, lastBlock](const auto& item) {
+        return GetFirstEventBlock(item->GetEPGInfoTag()) <= lastBlock;
+      });
+  tags.erase(last.base(), tags.cend());
+
+  if (tags.empty())
+    return false;
+
+  epgTags.firstBlock =
+      std::max(epgTags.firstBlock, GetFirstEventBlock(tags.front()->GetEPGInfoTag()));
+  epgTags.lastBlock =
+      std::min(epgTags.lastBlock, GetLastEventBlock(tags.back()->GetEPGInfoTag()));
+  return true;
+}
+
 std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::GetItem(int iChannel, int iBlock) const
 {
   std::shared_ptr<CFileItem> result;
@@ -511,8 +537,16 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   if (!channelsChanged && !blocksChanged)
     return false;
 
-  // clear the grid. it will be recreated on-demand.
-  m_gridIndex.clear();
+  // drop the grid items outside the new viewport. the others will be recreated on-demand.
+  for (auto it = m_gridIndex.begin(); it != m_gridIndex.end();)
+  {
+    const GridCoordinates& coordinates = (*it).first;
+    if (coordinates.channel < firstChannel || coordinates.channel > lastChannel ||
+        coordinates.block < firstBlock || coordinates.block > lastBlock)
+      it = m_gridIndex.erase(it);
+    else
+      ++it;
+  }
 
   bool newChannels = false;
 
@@ -534,38 +568,51 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
 
   if (blocksChanged || newChannels)
   {
-    // clear and refetch epg tags for active channels
+    // Only fetch what is not already there. Scrolling by a block must not reload the timelines
+    // of all channels in the viewport.
     const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
     const CDateTime minStart = GetStartTimeForBlock(lastBlock);
     std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
     for (int i = firstChannel; i <= lastChannel; ++i)
     {
       auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.insert({i, EpgTags()}).first;
+      if (it != m_epgItems.end() && blocksChanged &&
+          !TrimEpgTags((*it).second, firstBlock, lastBlock))
+      {
+        // nothing left in the new viewport
+        m_epgItems.erase(it);
+        it = m_epgItems.end();
+      }
 
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
+      if (it != m_epgItems.end())
       {
+        // extend the tags of channels we already have to the new viewport
         EpgTags& epgTags = (*it).second;
+        if (!epgTags.tags.empty() && firstBlock < epgTags.firstBlock)
+          GetEpgTagsBefore(epgTags, i, firstBlock);
+        if (!epgTags.tags.empty() && lastBlock > epgTags.lastBlock)
+          GetEpgTagsAfter(epgTags, i, lastBlock);
+        continue;
+      }
 
-        (*it).second.tags.clear();
+      it = m_epgItems.insert({i, EpgTags()}).first;
+      EpgTags& epgTags = (*it).second;
 
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
+      tags = GetEPGTimeline(i, maxEnd, minStart);
+      const int firstResultBlock = GetFirstEventBlock(tags.front());
+      const int lastResultBlock = GetLastEventBlock(tags.back());
+      if (firstResultBlock > lastResultBlock)
+        continue;
 
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
+      epgTags.firstBlock = firstResultBlock;
+      epgTags.lastBlock = lastResultBlock;
 
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
+      for (const auto& tag : tags)
+      {
+        if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
+          continue;
 
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
+        epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
       }
     }
   }
@@ -51,6 +51,7 @@ public:
   CGUIEPGGridContainerModel() = default;
   virtual ~CGUIEPGGridContainerModel() = default;
 
+  // creates the channel and ruler items, grid items are created on demand for the viewport
   void Initialize(const std::unique_ptr<CFileItemList>& items,
                   const CDateTime& gridStart,
                   const CDateTime& gridEnd,
@@ -135,6 +136,7 @@ private:
                                         int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  bool TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const;
 
   mutable EpgTagsMap m_epgItems;
 
@@ -39,20 +39,25 @@ CPVRRecordings::~CPVRRecordings()
 
 bool CPVRRecordings::UpdateFromClients(const std::vector<std::shared_ptr<CPVRClient>>& clients)
 {
-  std::unique_lock<CCriticalSection> lock(m_critSection);
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
 
-  if (m_bIsUpdating)
-    return false;
+    if (m_bIsUpdating)
+      return false;
 
-  m_bIsUpdating = true;
+    m_bIsUpdating = true;
 
-  for (const auto& recording : m_recordings)
-    recording.second->SetDirty(true);
+    for (const auto& recording : m_recordings)
+      recording.second->SetDirty(true);
+  }
 
+  // not locked, the clients are called concurrently and add their recordings one by one
   std::vector<int> failedClients;
   CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, false, failedClients);
   CServiceBroker::GetPVRManager().Clients()->GetRecordings(clients, this, true, failedClients);
 
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
   // remove recordings that were deleted at the backend
   for (auto it = m_recordings.begin(); it != m_recordings.end();)
   {
@@ -87,7 +87,32 @@ public:
 
   virtual void ShowSplash(const std::string& message);
 
+  /*!
+   * \brief Draw everything that has been batched up so far.
+   *
+   * Must be called before rendering anything that doesn't go through the render
+   * system's own GUI batching, e.g. video or addon rendering, so the draw order
+   * is preserved.
+   */
+  virtual void FlushGUIBatch() {}
+
+  /*!
+   * \brief Account for draw calls issued by the GUI in the current frame.
+   */
+  void AddDrawCalls(unsigned int count = 1) { m_drawCalls += count; }
+
+  /*!
+   * \brief Number of draw calls issued by the GUI in the last presented frame.
+   */
+  unsigned int GetDrawCallsLastFrame() const { return m_drawCallsLastFrame; }
+
 protected:
+  void ResetDrawCalls()
+  {
+    m_drawCallsLastFrame = m_drawCalls;
+    m_drawCalls = 0;
+  }
+
   bool                m_bRenderCreated;
   bool                m_bVSync;
   unsigned int        m_maxTextureSize;
@@ -102,6 +127,8 @@ protected:
   RENDER_STEREO_MODE m_stereoMode = RENDER_STEREO_MODE_OFF;
   bool m_limitedColorRange = false;
   bool m_transferPQ{false};
+  unsigned int m_drawCalls{0};
+  unsigned int m_drawCallsLastFrame{0};
 
   std::unique_ptr<CGUIImage> m_splashImage;
   std::unique_ptr<CGUITextLayout> m_splashMessageLayout;
@@ -21,6 +21,7 @@
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <cstddef>
 #include <exception>
 
 #if defined(TARGET_LINUX)
@@ -237,6 +238,18 @@ bool CRenderSystemGL::ResetRenderSystem(int width, int height)
 
 bool CRenderSystemGL::DestroyRenderSystem()
 {
+  m_guiBatch.Clear();
+  if (m_guiBatchVertexVBO != GL_NONE)
+  {
+    glDeleteBuffers(1, &m_guiBatchVertexVBO);
+    m_guiBatchVertexVBO = GL_NONE;
+  }
+  if (m_guiBatchIndexVBO != GL_NONE)
+  {
+    glDeleteBuffers(1, &m_guiBatchIndexVBO);
+    m_guiBatchIndexVBO = GL_NONE;
+  }
+
   if (m_vertexArray != GL_NONE)
   {
     glDeleteVertexArrays(1, &m_vertexArray);
@@ -270,6 +283,8 @@ bool CRenderSystemGL::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushGUIBatch();
+
   return true;
 }
 
@@ -278,6 +293,8 @@ void CRenderSystemGL::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if (m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return;
@@ -302,6 +319,8 @@ bool CRenderSystemGL::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  FlushGUIBatch();
+
   /* clear is not affected by stipple pattern, so we can only clear on first frame */
   if(m_stereoMode == RENDER_STEREO_MODE_INTERLACED && m_stereoView == RENDER_STEREO_VIEW_RIGHT)
     return true;
@@ -362,6 +381,9 @@ void CRenderSystemGL::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+  ResetDrawCalls();
+
   PresentRenderImpl(rendered);
 
   if (!rendered)
@@ -392,6 +414,8 @@ void CRenderSystemGL::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -423,6 +447,8 @@ void CRenderSystemGL::SetCameraPosition(const CPoint &camera, int screenWidth, i
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
 
@@ -498,6 +524,8 @@ void CRenderSystemGL::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -532,6 +560,8 @@ void CRenderSystemGL::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushGUIBatch();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -546,6 +576,8 @@ void CRenderSystemGL::ResetScissors()
 
 void CRenderSystemGL::SetDepthCulling(DEPTH_CULLING culling)
 {
+  FlushGUIBatch();
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -625,6 +657,8 @@ static const GLubyte stipple_3d[] = {
 
 void CRenderSystemGL::SetStereoMode(RENDER_STEREO_MODE mode, RENDER_STEREO_VIEW view)
 {
+  FlushGUIBatch();
+
   CRenderSystemBase::SetStereoMode(mode, view);
 
   glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -818,6 +852,11 @@ void CRenderSystemGL::ReleaseShaders()
 
 void CRenderSystemGL::EnableShader(ShaderMethodGL method)
 {
+  // anything enabling a GUI shader is about to draw, so everything batched so far
+  // has to hit the screen first to keep the draw order
+  if (!m_flushingGUIBatch && !m_guiBatch.IsEmpty())
+    FlushGUIBatchKeepState();
+
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -934,3 +973,167 @@ std::string CRenderSystemGL::GetShaderPath(const std::string &filename)
 
   return path;
 }
+
+void CRenderSystemGL::AddGUIQuads(const GUIQuadBatchState& state,
+                                  const CGUIQuadBatch::Vertex* vertices,
+                                  size_t count)
+{
+  if (count == 0)
+    return;
+
+  const size_t quads = count / 4;
+  if (quads > CGUIQuadBatch::MAX_QUADS)
+    return;
+
+  if (!m_guiBatch.CanAppend(state, quads))
+    FlushGUIBatch();
+
+  // the shader picks up the matrices when it gets enabled, remember the ones
+  // the quads were submitted with in case they change before the flush
+  if (m_guiBatch.IsEmpty())
+  {
+    m_guiBatchProject = glMatrixProject.Get();
+    m_guiBatchModview = glMatrixModview.Get();
+  }
+
+  m_guiBatch.Append(state, vertices, count);
+}
+
+void CRenderSystemGL::FlushGUIBatchKeepState()
+{
+  // callers usually bind their textures and set up blending before enabling
+  // the shader, so restore what the flush is going to overwrite
+  GLint activeTexture;
+  GLint texture0;
+  GLint texture1;
+  GLint blendSrcRGB;
+  GLint blendDstRGB;
+  GLint blendSrcAlpha;
+  GLint blendDstAlpha;
+  glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+  glActiveTexture(GL_TEXTURE1);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture1);
+  glActiveTexture(GL_TEXTURE0);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture0);
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blendSrcRGB);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blendDstRGB);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendSrcAlpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blendDstAlpha);
+  const GLboolean blend = glIsEnabled(GL_BLEND);
+
+  FlushGUIBatch();
+
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, texture1);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, texture0);
+  glActiveTexture(activeTexture);
+  glBlendFuncSeparate(blendSrcRGB, blendDstRGB, blendSrcAlpha, blendDstAlpha);
+  if (blend)
+    glEnable(GL_BLEND);
+  else
+    glDisable(GL_BLEND);
+}
+
+void CRenderSystemGL::FlushGUIBatch()
+{
+  if (m_guiBatch.IsEmpty() || m_flushingGUIBatch)
+    return;
+
+  m_flushingGUIBatch = true;
+
+  const GUIQuadBatchState& state = m_guiBatch.GetState();
+  const std::vector<CGUIQuadBatch::Vertex>& vertices = m_guiBatch.GetVertices();
+  const std::vector<uint16_t>& indices = m_guiBatch.GetIndices();
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, state.texture);
+  if (state.diffuse)
+  {
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, state.diffuse);
+  }
+
+  if (state.blending)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable(GL_BLEND);
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  glMatrixProject.Push();
+  glMatrixModview.Push();
+  glMatrixProject.Get() = m_guiBatchProject;
+  glMatrixModview.Get() = m_guiBatchModview;
+
+  EnableShader(static_cast<ShaderMethodGL>(state.shader));
+
+  GLint posLoc = ShaderGetPos();
+  GLint tex0Loc = ShaderGetCoord0();
+  GLint tex1Loc = ShaderGetCoord1();
+  GLint uniColLoc = ShaderGetUniCol();
+  GLint depthLoc = ShaderGetDepth();
+
+  if (m_guiBatchVertexVBO == GL_NONE)
+    glGenBuffers(1, &m_guiBatchVertexVBO);
+  if (m_guiBatchIndexVBO == GL_NONE)
+    glGenBuffers(1, &m_guiBatchIndexVBO);
+
+  // the buffers are reused every flush, GL_STREAM_DRAW lets the driver orphan them
+  glBindBuffer(GL_ARRAY_BUFFER, m_guiBatchVertexVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(CGUIQuadBatch::Vertex) * vertices.size(), vertices.data(),
+               GL_STREAM_DRAW);
+
+  glUniform1f(depthLoc, state.depth);
+
+  if (uniColLoc >= 0)
+  {
+    glUniform4f(uniColLoc, (state.color[0] / 255.0f), (state.color[1] / 255.0f),
+                (state.color[2] / 255.0f), (state.color[3] / 255.0f));
+  }
+
+  if (state.diffuse)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                          reinterpret_cast<const GLvoid*>(offsetof(CGUIQuadBatch::Vertex, u2)));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(CGUIQuadBatch::Vertex, x)));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                        reinterpret_cast<const GLvoid*>(offsetof(CGUIQuadBatch::Vertex, u1)));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_guiBatchIndexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * indices.size(), indices.data(),
+               GL_STREAM_DRAW);
+
+  glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_SHORT, 0);
+  AddDrawCalls();
+
+  if (state.diffuse)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+  if (state.diffuse)
+    glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  DisableShader();
+
+  glMatrixProject.PopLoad();
+  glMatrixModview.PopLoad();
+
+  m_guiBatch.Clear();
+  m_flushingGUIBatch = false;
+}
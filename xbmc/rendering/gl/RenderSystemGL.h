@@ -9,6 +9,8 @@
 #pragma once
 
 #include "GLShader.h"
+#include "guilib/GUIQuadBatch.h"
+#include "rendering/MatrixGL.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -124,12 +126,19 @@ public:
   GLint ShaderGetClip();
   GLint ShaderGetCoordStep();
 
+  // batched GUI texture rendering
+  void FlushGUIBatch() override;
+  void AddGUIQuads(const GUIQuadBatchState& state,
+                   const CGUIQuadBatch::Vertex* vertices,
+                   size_t count);
+
 protected:
   virtual void SetVSyncImpl(bool enable) = 0;
   virtual void PresentRenderImpl(bool rendered) = 0;
   void CalculateMaxTexturesize();
   void InitialiseShaders();
   void ReleaseShaders();
+  void FlushGUIBatchKeepState();
 
   bool m_bVsyncInit = false;
   int m_width;
@@ -145,4 +154,11 @@ protected:
   std::map<ShaderMethodGL, std::unique_ptr<CGLShader>> m_pShader;
   ShaderMethodGL m_method = ShaderMethodGL::SM_DEFAULT;
   GLuint m_vertexArray = GL_NONE;
+
+  CGUIQuadBatch m_guiBatch;
+  CMatrixGL m_guiBatchProject;
+  CMatrixGL m_guiBatchModview;
+  GLuint m_guiBatchVertexVBO = GL_NONE;
+  GLuint m_guiBatchIndexVBO = GL_NONE;
+  bool m_flushingGUIBatch = false;
 };
@@ -23,6 +23,7 @@
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 
+#include <cstddef>
 #include <exception>
 
 #if defined(TARGET_LINUX)
@@ -153,6 +154,7 @@ bool CRenderSystemGLES::ResetRenderSystem(int width, int height)
 
 bool CRenderSystemGLES::DestroyRenderSystem()
 {
+  m_guiBatch.Clear();
   ResetScissors();
   CDirtyRegionList dirtyRegions;
   CDirtyRegion dirtyWindow(CServiceBroker::GetWinSystem()->GetGfxContext().GetViewWindow());
@@ -194,6 +196,8 @@ bool CRenderSystemGLES::EndRender()
   if (!m_bRenderCreated)
     return false;
 
+  FlushGUIBatch();
+
   return true;
 }
 
@@ -202,6 +206,8 @@ void CRenderSystemGLES::InvalidateColorBuffer()
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   // some platforms prefer a clear, instead of rendering over
   if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiGeometryClear)
     ClearBuffers(0);
@@ -219,6 +225,8 @@ bool CRenderSystemGLES::ClearBuffers(KODI::UTILS::COLOR::Color color)
   if (!m_bRenderCreated)
     return false;
 
+  FlushGUIBatch();
+
   float r = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::R, color) / 255.0f;
   float g = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::G, color) / 255.0f;
   float b = KODI::UTILS::GL::GetChannelFromARGB(KODI::UTILS::GL::ColorChannel::B, color) / 255.0f;
@@ -265,6 +273,9 @@ void CRenderSystemGLES::PresentRender(bool rendered, bool videoLayer)
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+  ResetDrawCalls();
+
   PresentRenderImpl(rendered);
 
   // if video is rendered to a separate layer, we should not block this thread
@@ -295,6 +306,8 @@ void CRenderSystemGLES::CaptureStateBlock()
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   glMatrixProject.Push();
   glMatrixModview.Push();
   glMatrixTexture.Push();
@@ -324,6 +337,8 @@ void CRenderSystemGLES::SetCameraPosition(const CPoint &camera, int screenWidth,
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   CPoint offset = camera - CPoint(screenWidth*0.5f, screenHeight*0.5f);
 
   float w = (float)m_viewPort[2]*0.5f;
@@ -372,6 +387,8 @@ void CRenderSystemGLES::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
+  FlushGUIBatch();
+
   glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
@@ -406,6 +423,8 @@ void CRenderSystemGLES::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
+
+  FlushGUIBatch();
   GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
   GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
   GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
@@ -420,6 +439,8 @@ void CRenderSystemGLES::ResetScissors()
 
 void CRenderSystemGLES::SetDepthCulling(DEPTH_CULLING culling)
 {
+  FlushGUIBatch();
+
   if (culling == DEPTH_CULLING_OFF)
   {
     glDisable(GL_DEPTH_TEST);
@@ -633,6 +654,11 @@ void CRenderSystemGLES::ReleaseShaders()
 
 void CRenderSystemGLES::EnableGUIShader(ShaderMethodGLES method)
 {
+  // anything enabling a GUI shader is about to draw, so everything batched so far
+  // has to hit the screen first to keep the draw order
+  if (!m_flushingGUIBatch && !m_guiBatch.IsEmpty())
+    FlushGUIBatchKeepState();
+
   m_method = method;
   if (m_pShader[m_method])
   {
@@ -792,3 +818,150 @@ std::string CRenderSystemGLES::GetShaderPath(const std::string& filename)
 
   return path;
 }
+
+void CRenderSystemGLES::AddGUIQuads(const GUIQuadBatchState& state,
+                                    const CGUIQuadBatch::Vertex* vertices,
+                                    size_t count)
+{
+  if (count == 0)
+    return;
+
+  const size_t quads = count / 4;
+  if (quads > CGUIQuadBatch::MAX_QUADS)
+    return;
+
+  if (!m_guiBatch.CanAppend(state, quads))
+    FlushGUIBatch();
+
+  // the shader picks up the matrices when it gets enabled, remember the ones
+  // the quads were submitted with in case they change before the flush
+  if (m_guiBatch.IsEmpty())
+  {
+    m_guiBatchProject = glMatrixProject.Get();
+    m_guiBatchModview = glMatrixModview.Get();
+  }
+
+  m_guiBatch.Append(state, vertices, count);
+}
+
+void CRenderSystemGLES::FlushGUIBatchKeepState()
+{
+  // callers usually bind their textures and set up blending before enabling
+  // the shader, so restore what the flush is going to overwrite
+  GLint activeTexture;
+  GLint texture0;
+  GLint texture1;
+  GLint blendSrcRGB;
+  GLint blendDstRGB;
+  GLint blendSrcAlpha;
+  GLint blendDstAlpha;
+  glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+  glActiveTexture(GL_TEXTURE1);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture1);
+  glActiveTexture(GL_TEXTURE0);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture0);
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blendSrcRGB);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blendDstRGB);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendSrcAlpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blendDstAlpha);
+  const GLboolean blend = glIsEnabled(GL_BLEND);
+
+  FlushGUIBatch();
+
+  glActiveTexture(GL_TEXTURE1);
+  glBindTexture(GL_TEXTURE_2D, texture1);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, texture0);
+  glActiveTexture(activeTexture);
+  glBlendFuncSeparate(blendSrcRGB, blendDstRGB, blendSrcAlpha, blendDstAlpha);
+  if (blend)
+    glEnable(GL_BLEND);
+  else
+    glDisable(GL_BLEND);
+}
+
+void CRenderSystemGLES::FlushGUIBatch()
+{
+  if (m_guiBatch.IsEmpty() || m_flushingGUIBatch)
+    return;
+
+  m_flushingGUIBatch = true;
+
+  const GUIQuadBatchState& state = m_guiBatch.GetState();
+  const std::vector<CGUIQuadBatch::Vertex>& vertices = m_guiBatch.GetVertices();
+  const std::vector<uint16_t>& indices = m_guiBatch.GetIndices();
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, state.texture);
+  if (state.diffuse)
+  {
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, state.diffuse);
+  }
+
+  if (state.blending)
+  {
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA, GL_ONE);
+    glEnable(GL_BLEND);
+  }
+  else
+  {
+    glDisable(GL_BLEND);
+  }
+
+  glMatrixProject.Push();
+  glMatrixModview.Push();
+  glMatrixProject.Get() = m_guiBatchProject;
+  glMatrixModview.Get() = m_guiBatchModview;
+
+  EnableGUIShader(static_cast<ShaderMethodGLES>(state.shader));
+
+  GLint posLoc = GUIShaderGetPos();
+  GLint tex0Loc = GUIShaderGetCoord0();
+  GLint tex1Loc = GUIShaderGetCoord1();
+  GLint uniColLoc = GUIShaderGetUniCol();
+  GLint depthLoc = GUIShaderGetDepth();
+
+  if (uniColLoc >= 0)
+  {
+    glUniform4f(uniColLoc, (state.color[0] / 255.0f), (state.color[1] / 255.0f),
+                (state.color[2] / 255.0f), (state.color[3] / 255.0f));
+  }
+
+  glUniform1f(depthLoc, state.depth);
+
+  const char* base = reinterpret_cast<const char*>(vertices.data());
+  if (state.diffuse)
+  {
+    glVertexAttribPointer(tex1Loc, 2, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                          base + offsetof(CGUIQuadBatch::Vertex, u2));
+    glEnableVertexAttribArray(tex1Loc);
+  }
+  glVertexAttribPointer(posLoc, 3, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                        base + offsetof(CGUIQuadBatch::Vertex, x));
+  glEnableVertexAttribArray(posLoc);
+  glVertexAttribPointer(tex0Loc, 2, GL_FLOAT, 0, sizeof(CGUIQuadBatch::Vertex),
+                        base + offsetof(CGUIQuadBatch::Vertex, u1));
+  glEnableVertexAttribArray(tex0Loc);
+
+  glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_SHORT, indices.data());
+  AddDrawCalls();
+
+  if (state.diffuse)
+    glDisableVertexAttribArray(tex1Loc);
+
+  glDisableVertexAttribArray(posLoc);
+  glDisableVertexAttribArray(tex0Loc);
+
+  if (state.diffuse)
+    glActiveTexture(GL_TEXTURE0);
+  glEnable(GL_BLEND);
+
+  DisableGUIShader();
+
+  glMatrixProject.PopLoad();
+  glMatrixModview.PopLoad();
+
+  m_guiBatch.Clear();
+  m_flushingGUIBatch = false;
+}
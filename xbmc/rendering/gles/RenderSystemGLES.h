@@ -9,6 +9,8 @@
 #pragma once
 
 #include "GLESShader.h"
+#include "guilib/GUIQuadBatch.h"
+#include "rendering/MatrixGL.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -134,10 +136,17 @@ public:
   GLint GUIShaderGetCoordStep();
   GLint GUIShaderGetDepth();
 
+  // batched GUI texture rendering
+  void FlushGUIBatch() override;
+  void AddGUIQuads(const GUIQuadBatchState& state,
+                   const CGUIQuadBatch::Vertex* vertices,
+                   size_t count);
+
 protected:
   virtual void SetVSyncImpl(bool enable) = 0;
   virtual void PresentRenderImpl(bool rendered) = 0;
   void CalculateMaxTexturesize();
+  void FlushGUIBatchKeepState();
 
   bool m_bVsyncInit{false};
   int m_width;
@@ -149,4 +158,9 @@ protected:
   ShaderMethodGLES m_method = ShaderMethodGLES::SM_DEFAULT;
 
   GLint      m_viewPort[4];
+
+  CGUIQuadBatch m_guiBatch;
+  CMatrixGL m_guiBatchProject;
+  CMatrixGL m_guiBatchModview;
+  bool m_flushingGUIBatch{false};
 };
@@ -168,6 +168,10 @@ void CAdvancedSettings::Initialize()
   m_videoFpsDetect = 1;
   m_maxTempo = 1.55f;
   m_videoPreferStereoStream = false;
+  m_videoKeyframeIndexOnScan = false;
+  m_videoTrickplayOnScan = false;
+  m_videoProbeThreads = 4;
+  m_videoMmapInput = false;
 
   m_videoDefaultLatency = 0.0;
   m_videoDefaultHdrExtraLatency = 0.0;
@@ -410,6 +414,8 @@ void CAdvancedSettings::Initialize()
 
   m_jsonOutputCompact = true;
   m_jsonTcpPort = 9090;
+  m_jsonCacheSize = 16;
+  m_jsonCachedMethods.clear();
 
   m_enableMultimediaKeys = false;
 
@@ -743,6 +749,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.1);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
+    XMLUtils::GetBoolean(pElement, "keyframeindexonscan", m_videoKeyframeIndexOnScan);
+    XMLUtils::GetBoolean(pElement, "trickplayonscan", m_videoTrickplayOnScan);
+    XMLUtils::GetInt(pElement, "probethreads", m_videoProbeThreads, 1, 16);
+    XMLUtils::GetBoolean(pElement, "mmapinput", m_videoMmapInput);
 
     // Store global display latency settings
     TiXmlElement* pVideoLatency = pElement->FirstChildElement("latency");
@@ -867,6 +877,11 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   {
     XMLUtils::GetBoolean(pElement, "compactoutput", m_jsonOutputCompact);
     XMLUtils::GetUInt(pElement, "tcpport", m_jsonTcpPort);
+    XMLUtils::GetUInt(pElement, "cachesize", m_jsonCacheSize);
+
+    std::string cachedMethods;
+    if (XMLUtils::GetString(pElement, "cachedmethods", cachedMethods))
+      m_jsonCachedMethods = StringUtils::Split(cachedMethods, ',');
   }
 
   pElement = pRootElement->FirstChildElement("samba");
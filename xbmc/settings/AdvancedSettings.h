@@ -172,6 +172,10 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    bool m_videoKeyframeIndexOnScan = false;
+    bool m_videoTrickplayOnScan = false;
+    int m_videoProbeThreads = 4;
+    bool m_videoMmapInput = false;
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -344,6 +348,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     bool m_jsonOutputCompact;
     unsigned int m_jsonTcpPort;
+    unsigned int m_jsonCacheSize; //!< size of the cached JSON-RPC results in MiB
+    std::vector<std::string> m_jsonCachedMethods; //!< JSON-RPC methods cached, none by default
 
     bool m_enableMultimediaKeys;
     std::vector<std::string> m_settingsFiles;
@@ -50,6 +50,7 @@ const std::string& CSkinSettings::GetString(int setting) const
 void CSkinSettings::SetString(int setting, const std::string &label)
 {
   g_SkinInfo->SetString(setting, label);
+  NotifySettingsChanged();
 }
 
 int CSkinSettings::TranslateBool(const std::string &setting)
@@ -70,11 +71,13 @@ int CSkinSettings::GetInt(int setting) const
 void CSkinSettings::SetBool(int setting, bool set)
 {
   g_SkinInfo->SetBool(setting, set);
+  NotifySettingsChanged();
 }
 
 void CSkinSettings::Reset(const std::string &setting)
 {
   g_SkinInfo->Reset(setting);
+  NotifySettingsChanged();
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
@@ -102,6 +105,11 @@ void CSkinSettings::Reset()
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 }
 
+void CSkinSettings::NotifySettingsChanged()
+{
+  CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetSkinInfoProvider().NotifySettingsChanged();
+}
+
 bool CSkinSettings::Load(const TiXmlNode *settings)
 {
   if (settings == nullptr)
@@ -178,6 +186,7 @@ void CSkinSettings::MigrateSettings(const std::shared_ptr<ADDON::CSkinInfo>& ski
   {
     // save the skin's settings
     skin->SaveSettings();
+    NotifySettingsChanged();
 
     // save the guisettings.xml
     CServiceBroker::GetSettingsComponent()->GetSettings()->Save();
@@ -50,6 +50,11 @@ public:
   void Reset(const std::string &setting);
   void Reset();
 
+  /*! \brief Let the GUI know that skin settings have changed
+   Only needs to be called by code changing skin settings without going through this class.
+   */
+  static void NotifySettingsChanged();
+
 protected:
   CSkinSettings();
   CSkinSettings(const CSkinSettings&) = delete;
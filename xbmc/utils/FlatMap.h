@@ -0,0 +1,117 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Associative container keeping its elements in a vector sorted by key.
+ *
+ *        It implements the subset of the std::map interface used for small
+ *        maps built once and read often, like the members of a JSON object.
+ *        Compared to std::map the elements are stored in one contiguous block
+ *        instead of a node allocation per element, and lookups are binary
+ *        searches over adjacent memory. Inserting or erasing is linear though.
+ *
+ *        Unlike std::map, inserting or erasing an element invalidates
+ *        iterators and references to the other elements.
+ */
+template<typename Key, typename Value>
+class CFlatMap
+{
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using size_type = typename std::vector<value_type>::size_type;
+  using iterator = typename std::vector<value_type>::iterator;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  iterator begin() { return m_elements.begin(); }
+  const_iterator begin() const { return m_elements.begin(); }
+  const_iterator cbegin() const { return m_elements.cbegin(); }
+  iterator end() { return m_elements.end(); }
+  const_iterator end() const { return m_elements.end(); }
+  const_iterator cend() const { return m_elements.cend(); }
+
+  size_type size() const { return m_elements.size(); }
+  bool empty() const { return m_elements.empty(); }
+  void clear() { m_elements.clear(); }
+  void reserve(size_type size) { m_elements.reserve(size); }
+
+  iterator find(const Key& key)
+  {
+    const auto it = LowerBound(key);
+    return it != m_elements.end() && !(key < it->first) ? it : m_elements.end();
+  }
+
+  const_iterator find(const Key& key) const
+  {
+    const auto it = LowerBound(key);
+    return it != m_elements.cend() && !(key < it->first) ? it : m_elements.cend();
+  }
+
+  Value& operator[](const Key& key)
+  {
+    auto it = LowerBound(key);
+    if (it == m_elements.end() || key < it->first)
+      it = m_elements.emplace(it, key, Value());
+    return it->second;
+  }
+
+  template<typename... Args>
+  std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+  {
+    auto it = LowerBound(key);
+    if (it != m_elements.end() && !(key < it->first))
+      return {it, false};
+
+    it = m_elements.emplace(it, std::piecewise_construct, std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+    return {it, true};
+  }
+
+  size_type erase(const Key& key)
+  {
+    const auto it = find(key);
+    if (it == m_elements.end())
+      return 0;
+
+    m_elements.erase(it);
+    return 1;
+  }
+
+  iterator erase(const_iterator position) { return m_elements.erase(position); }
+
+  bool operator==(const CFlatMap& rhs) const { return m_elements == rhs.m_elements; }
+
+private:
+  iterator LowerBound(const Key& key)
+  {
+    // appending in order is the common case (parsers, copies of sorted maps), don't search for it
+    if (m_elements.empty() || m_elements.back().first < key)
+      return m_elements.end();
+
+    return std::lower_bound(m_elements.begin(), m_elements.end(), key,
+                            [](const value_type& element, const Key& k)
+                            { return element.first < k; });
+  }
+
+  const_iterator LowerBound(const Key& key) const
+  {
+    return std::lower_bound(m_elements.cbegin(), m_elements.cend(), key,
+                            [](const value_type& element, const Key& k)
+                            { return element.first < k; });
+  }
+
+  std::vector<value_type> m_elements;
+};
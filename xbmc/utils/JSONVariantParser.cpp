@@ -8,6 +8,8 @@
 
 #include "JSONVariantParser.h"
 
+#include "utils/RapidJSONConfig.h"
+
 #include <rapidjson/reader.h>
 
 class CJSONVariantParserHandler
@@ -34,27 +36,21 @@ private:
   template <typename... TArgs>
   bool Primitive(TArgs... args)
   {
-    PushObject(CVariant(std::forward<TArgs>(args)...));
-    PopObject();
+    Add(CVariant(std::forward<TArgs>(args)...));
+    if (m_parse.empty())
+      m_parsedObject = std::move(m_root);
 
     return true;
   }
 
-  void PushObject(CVariant variant);
+  CVariant* Add(CVariant&& variant);
+  void PushObject(CVariant&& variant);
   void PopObject();
 
   CVariant& m_parsedObject;
   std::vector<CVariant *> m_parse;
   std::string m_key;
   CVariant m_root;
-
-  enum class PARSE_STATUS
-  {
-    Variable,
-    Array,
-    Object
-  };
-  PARSE_STATUS m_status = PARSE_STATUS::Variable;
 };
 
 CJSONVariantParserHandler::CJSONVariantParserHandler(CVariant& parsedObject)
@@ -63,10 +59,7 @@ CJSONVariantParserHandler::CJSONVariantParserHandler(CVariant& parsedObject)
 
 bool CJSONVariantParserHandler::Null()
 {
-  PushObject(CVariant::ConstNullVariant);
-  PopObject();
-
-  return true;
+  return Primitive(CVariant::ConstNullVariant);
 }
 
 bool CJSONVariantParserHandler::Bool(bool b)
@@ -118,7 +111,7 @@ bool CJSONVariantParserHandler::StartObject()
 
 bool CJSONVariantParserHandler::Key(const char* str, rapidjson::SizeType length, bool copy)
 {
-  m_key = std::string(str, 0, length);
+  m_key.assign(str, length);
 
   return true;
 }
@@ -144,56 +137,40 @@ bool CJSONVariantParserHandler::EndArray(rapidjson::SizeType elementCount)
   return true;
 }
 
-void CJSONVariantParserHandler::PushObject(CVariant variant)
+CVariant* CJSONVariantParserHandler::Add(CVariant&& variant)
 {
-  const auto variant_type = variant.type();
-
-  if (m_status == PARSE_STATUS::Object)
+  if (m_parse.empty())
   {
-    (*m_parse.back())[m_key] = std::move(variant);
-    m_parse.push_back(&((*m_parse.back())[m_key]));
-  }
-  else if (m_status == PARSE_STATUS::Array)
-  {
-    CVariant *temp = m_parse[m_parse.size() - 1];
-    temp->push_back(std::move(variant));
-    m_parse.push_back(&(*temp)[temp->size() - 1]);
+    m_root = std::move(variant);
+    return &m_root;
   }
-  else if (m_parse.empty())
+
+  // values are added in place, the containers open are the last ones of their parents
+  CVariant& parent = *m_parse.back();
+  if (parent.isObject())
   {
-    m_root = std::move(variant);
-    m_parse.push_back(&m_root);
+    CVariant& member = parent[m_key];
+    member = std::move(variant);
+    return &member;
   }
 
-  if (variant_type == CVariant::VariantTypeObject)
-    m_status = PARSE_STATUS::Object;
-  else if (variant_type == CVariant::VariantTypeArray)
-    m_status = PARSE_STATUS::Array;
-  else
-    m_status = PARSE_STATUS::Variable;
+  parent.push_back(std::move(variant));
+  return &parent[parent.size() - 1];
+}
+
+void CJSONVariantParserHandler::PushObject(CVariant&& variant)
+{
+  m_parse.push_back(Add(std::move(variant)));
 }
 
 void CJSONVariantParserHandler::PopObject()
 {
   assert(!m_parse.empty());
-  CVariant* variant = m_parse.back();
   m_parse.pop_back();
 
-  if (!m_parse.empty())
-  {
-    variant = m_parse[m_parse.size() - 1];
-    if (variant->isObject())
-      m_status = PARSE_STATUS::Object;
-    else if (variant->isArray())
-      m_status = PARSE_STATUS::Array;
-    else
-      m_status = PARSE_STATUS::Variable;
-  }
-  else
-  {
-    m_parsedObject = *variant;
-    m_status = PARSE_STATUS::Variable;
-  }
+  // only hand out complete documents
+  if (m_parse.empty())
+    m_parsedObject = std::move(m_root);
 }
 
 bool CJSONVariantParser::Parse(const char* json, CVariant& data)
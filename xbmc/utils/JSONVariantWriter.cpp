@@ -8,12 +8,21 @@
 
 #include "JSONVariantWriter.h"
 
+#include "utils/RapidJSONConfig.h"
 #include "utils/Variant.h"
 
+#include <utility>
+
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+namespace
+{
+// Buffered JSON is passed on to the output in chunks of this size.
+constexpr size_t STREAM_CHUNK_SIZE = 64 * 1024;
+} // unnamed namespace
+
 template<class TWriter>
 bool InternalWrite(TWriter& writer, const CVariant &value)
 {
@@ -90,3 +99,156 @@ bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool
   output = stringBuffer.GetString();
   return true;
 }
+
+class CJSONVariantStreamWriter::IWriter
+{
+public:
+  virtual ~IWriter() = default;
+
+  virtual bool StartObject() = 0;
+  virtual bool EndObject() = 0;
+  virtual bool StartArray() = 0;
+  virtual bool EndArray() = 0;
+  virtual bool Key(const std::string& key) = 0;
+  virtual bool Write(const CVariant& value) = 0;
+  virtual bool Flush() = 0;
+  virtual bool IsComplete() const = 0;
+};
+
+namespace
+{
+// rapidjson output stream passing the written JSON on in chunks
+class COutputStream
+{
+public:
+  typedef char Ch;
+
+  explicit COutputStream(CJSONVariantStreamWriter::Output output) : m_output(std::move(output))
+  {
+    m_buffer.reserve(STREAM_CHUNK_SIZE);
+  }
+
+  void Put(char c)
+  {
+    m_buffer.push_back(c);
+    if (m_buffer.size() >= STREAM_CHUNK_SIZE)
+      Flush();
+  }
+
+  void Flush()
+  {
+    if (m_buffer.empty())
+      return;
+
+    if (!m_failed && !m_output(m_buffer.data(), m_buffer.size()))
+      m_failed = true;
+
+    m_buffer.clear();
+  }
+
+  bool HasFailed() const { return m_failed; }
+
+private:
+  CJSONVariantStreamWriter::Output m_output;
+  std::string m_buffer;
+  bool m_failed = false;
+};
+
+template<class TWriter>
+class CStreamWriter : public CJSONVariantStreamWriter::IWriter
+{
+public:
+  explicit CStreamWriter(CJSONVariantStreamWriter::Output output)
+    : m_stream(std::move(output)), m_writer(m_stream)
+  {
+  }
+
+  bool StartObject() override { return m_writer.StartObject() && !m_stream.HasFailed(); }
+  bool EndObject() override { return m_writer.EndObject() && !m_stream.HasFailed(); }
+  bool StartArray() override { return m_writer.StartArray() && !m_stream.HasFailed(); }
+  bool EndArray() override { return m_writer.EndArray() && !m_stream.HasFailed(); }
+
+  bool Key(const std::string& key) override
+  {
+    return m_writer.Key(key.c_str(), static_cast<rapidjson::SizeType>(key.size())) &&
+           !m_stream.HasFailed();
+  }
+
+  bool Write(const CVariant& value) override
+  {
+    return InternalWrite(m_writer, value) && !m_stream.HasFailed();
+  }
+
+  bool Flush() override
+  {
+    m_stream.Flush();
+    return !m_stream.HasFailed();
+  }
+
+  bool IsComplete() const override { return m_writer.IsComplete(); }
+
+protected:
+  COutputStream m_stream;
+  TWriter m_writer;
+};
+
+class CPrettyStreamWriter : public CStreamWriter<rapidjson::PrettyWriter<COutputStream>>
+{
+public:
+  explicit CPrettyStreamWriter(CJSONVariantStreamWriter::Output output)
+    : CStreamWriter(std::move(output))
+  {
+    m_writer.SetIndent('\t', 1);
+  }
+};
+} // unnamed namespace
+
+CJSONVariantStreamWriter::CJSONVariantStreamWriter(Output output, bool compact)
+{
+  if (compact)
+    m_writer = std::make_unique<CStreamWriter<rapidjson::Writer<COutputStream>>>(std::move(output));
+  else
+    m_writer = std::make_unique<CPrettyStreamWriter>(std::move(output));
+}
+
+CJSONVariantStreamWriter::~CJSONVariantStreamWriter() = default;
+
+bool CJSONVariantStreamWriter::StartObject()
+{
+  return m_writer->StartObject();
+}
+
+bool CJSONVariantStreamWriter::EndObject()
+{
+  return m_writer->EndObject();
+}
+
+bool CJSONVariantStreamWriter::StartArray()
+{
+  return m_writer->StartArray();
+}
+
+bool CJSONVariantStreamWriter::EndArray()
+{
+  return m_writer->EndArray();
+}
+
+bool CJSONVariantStreamWriter::Key(const std::string& key)
+{
+  return m_writer->Key(key);
+}
+
+bool CJSONVariantStreamWriter::Write(const CVariant& value)
+{
+  return m_writer->Write(value);
+}
+
+bool CJSONVariantStreamWriter::Flush()
+{
+  return m_writer->Flush();
+}
+
+bool CJSONVariantStreamWriter::IsComplete() const
+{
+  return m_writer->IsComplete();
+}
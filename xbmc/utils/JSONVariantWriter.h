@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 
 class CVariant;
@@ -19,3 +21,46 @@ public:
 
   static bool Write(const CVariant &value, std::string& output, bool compact);
 };
+
+/*!
+ * \brief Writes JSON piece by piece to an output function, without building
+ * the complete document in memory first.
+ *
+ * The output is buffered and passed on in chunks. Values may be written as a
+ * whole from a CVariant, or structured with the Start/End methods.
+ */
+class CJSONVariantStreamWriter
+{
+public:
+  /*!
+   * \brief Receives the written JSON.
+   * \return False to abort writing, true otherwise.
+   */
+  using Output = std::function<bool(const char* data, size_t size)>;
+
+  CJSONVariantStreamWriter(Output output, bool compact);
+  ~CJSONVariantStreamWriter();
+
+  bool StartObject();
+  bool EndObject();
+  bool StartArray();
+  bool EndArray();
+  bool Key(const std::string& key);
+  bool Write(const CVariant& value);
+
+  /*!
+   * \brief Pass the buffered JSON on to the output.
+   * \return False if the output failed, true otherwise.
+   */
+  bool Flush();
+
+  /*!
+   * \brief Whether a complete JSON value was written.
+   */
+  bool IsComplete() const;
+
+  class IWriter;
+
+private:
+  std::unique_ptr<IWriter> m_writer;
+};
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace KODI::UTILS
+{
+/*!
+ * \brief Call a function for every index of a range, from several threads at once.
+ *
+ *        Each thread takes the next index until all are done, so one slow call
+ *        doesn't hold up the ones behind it. The calling thread is one of the
+ *        threads and the function returns once every call returned. This is
+ *        meant for a few blocking calls, like probing files on a share or
+ *        calling backends, that must not wait for a free job manager worker.
+ *
+ * \param count number of indices, the function is called for 0 to count - 1
+ * \param threads most calls at the same time
+ * \param function called with each index, must be safe to call concurrently
+ */
+template<typename Function>
+void ParallelFor(size_t count, size_t threads, const Function& function)
+{
+  std::atomic<size_t> next{0};
+  const auto worker = [&next, count, &function]()
+  {
+    for (size_t index = next++; index < count; index = next++)
+      function(index);
+  };
+
+  std::vector<std::future<void>> workers;
+  for (size_t i = 1; i < std::min(count, threads); i++)
+    workers.emplace_back(std::async(std::launch::async, worker));
+
+  worker();
+
+  for (auto& future : workers)
+    future.get();
+}
+} // namespace KODI::UTILS
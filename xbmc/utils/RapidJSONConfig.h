@@ -0,0 +1,25 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+ * \brief Configuration of rapidjson, include it before any rapidjson header.
+ *
+ * Enables the SIMD code paths of rapidjson the target is compiled for. They
+ * skip whitespace while parsing and scan strings while writing 16 bytes at
+ * a time. All translation units have to see the same configuration.
+ */
+
+#if defined(__SSE4_2__)
+#define RAPIDJSON_SSE42
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPIDJSON_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define RAPIDJSON_NEON
+#endif
@@ -269,6 +269,7 @@ CVariant::CVariant(std::vector<std::string>&& strArray)
 CVariant::CVariant(const std::map<std::string, std::string> &strMap)
 {
   VariantMap tmpMap;
+  tmpMap.reserve(strMap.size());
   for (const auto& elem : strMap)
     tmpMap.emplace(elem.first, CVariant(elem.second));
 
@@ -278,6 +279,7 @@ CVariant::CVariant(const std::map<std::string, std::string> &strMap)
 CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 {
   VariantMap tmpMap;
+  tmpMap.reserve(strMap.size());
   for (auto& elem : strMap)
     tmpMap.emplace(elem.first, CVariant(std::move(elem.second)));
 
@@ -285,13 +287,23 @@ CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 }
 
 CVariant::CVariant(const std::map<std::string, CVariant>& variantMap)
-  : m_data(std::in_place_type<VariantMap>, variantMap)
 {
+  VariantMap tmpMap;
+  tmpMap.reserve(variantMap.size());
+  for (const auto& elem : variantMap)
+    tmpMap.emplace(elem.first, elem.second);
+
+  m_data = std::move(tmpMap);
 }
 
 CVariant::CVariant(std::map<std::string, CVariant>&& variantMap)
-  : m_data(std::in_place_type<VariantMap>, std::move(variantMap))
 {
+  VariantMap tmpMap;
+  tmpMap.reserve(variantMap.size());
+  for (auto& elem : variantMap)
+    tmpMap.emplace(elem.first, std::move(elem.second));
+
+  m_data = std::move(tmpMap);
 }
 
 CVariant::CVariant(const CVariant& variant) : m_data(variant.m_data)
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "utils/FlatMap.h"
+
 #include <map>
 #include <stdint.h>
 #include <string>
@@ -124,7 +126,8 @@ public:
 
 private:
   typedef std::vector<CVariant> VariantArray;
-  typedef std::map<std::string, CVariant> VariantMap;
+  // objects are mostly small and built in key order, see CFlatMap
+  typedef CFlatMap<std::string, CVariant> VariantMap;
 
 public:
   typedef VariantArray::iterator        iterator_array;
@@ -0,0 +1,184 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/FlatMap.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// a VideoLibrary.GetMovies like result, the same for every run
+CVariant CreateLibraryPayload(unsigned int movies)
+{
+  CVariant result(CVariant::VariantTypeObject);
+  CVariant& items = result["movies"] = CVariant(CVariant::VariantTypeArray);
+  for (unsigned int i = 0; i < movies; i++)
+  {
+    const std::string id = std::to_string(i);
+
+    // properties are added in the order the library fills them in, not sorted
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = "Movie " + id;
+    movie["title"] = "Movie " + id;
+    movie["year"] = 1950 + i % 75;
+    movie["rating"] = (i % 100) / 10.0;
+    movie["runtime"] = 5400 + i % 3600;
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Thriller");
+    movie["plot"] = std::string(400, 'a' + i % 26);
+    movie["file"] = "/storage/movies/Movie " + id + "/Movie " + id + ".mkv";
+    movie["art"]["poster"] = "image://movie" + id + "/poster.jpg/";
+    movie["art"]["fanart"] = "image://movie" + id + "/fanart.jpg/";
+    movie["playcount"] = i % 3;
+    movie["lastplayed"] = "2026-01-01 20:00:00";
+    movie["dateadded"] = "2025-12-24 12:00:00";
+    movie["uniqueid"]["imdb"] = "tt" + id;
+    movie["uniqueid"]["tmdb"] = id;
+    movie["resume"]["position"] = 0;
+    movie["resume"]["total"] = 0;
+    CVariant video(CVariant::VariantTypeObject);
+    video["codec"] = "hevc";
+    video["width"] = 3840;
+    video["height"] = 2160;
+    video["duration"] = 5400 + i % 3600;
+    movie["streamdetails"]["video"].push_back(std::move(video));
+    CVariant audio(CVariant::VariantTypeObject);
+    audio["codec"] = "eac3";
+    audio["channels"] = 6;
+    audio["language"] = "eng";
+    movie["streamdetails"]["audio"].push_back(std::move(audio));
+    items.push_back(std::move(movie));
+  }
+  result["limits"]["start"] = 0;
+  result["limits"]["end"] = movies;
+  result["limits"]["total"] = movies;
+  return result;
+}
+
+template<typename Function>
+double MeasureMilliseconds(unsigned int runs, Function&& function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int run = 0; run < runs; run++)
+    function();
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / runs;
+}
+} // unnamed namespace
+
+TEST(TestFlatMap, KeepsElementsSorted)
+{
+  CFlatMap<std::string, int> map;
+  map["b"] = 2;
+  map["c"] = 3;
+  map["a"] = 1;
+  EXPECT_TRUE(map.emplace("d", 4).second);
+
+  ASSERT_EQ(4u, map.size());
+  EXPECT_TRUE(
+      std::is_sorted(map.cbegin(), map.cend(), [](auto& a, auto& b) { return a.first < b.first; }));
+  EXPECT_EQ("a", map.cbegin()->first);
+  EXPECT_EQ(4, (map.cend() - 1)->second);
+}
+
+TEST(TestFlatMap, Find)
+{
+  CFlatMap<std::string, int> map;
+  map["one"] = 1;
+  map["two"] = 2;
+
+  const auto& constMap = map;
+  ASSERT_NE(constMap.find("one"), constMap.cend());
+  EXPECT_EQ(1, constMap.find("one")->second);
+  EXPECT_EQ(2, map.find("two")->second);
+  EXPECT_EQ(constMap.find("three"), constMap.cend());
+  EXPECT_EQ(map.find(""), map.end());
+}
+
+TEST(TestFlatMap, InsertsOnce)
+{
+  CFlatMap<std::string, int> map;
+  map["key"] = 1;
+  map["key"]++;
+  EXPECT_FALSE(map.emplace("key", 5).second);
+
+  ASSERT_EQ(1u, map.size());
+  EXPECT_EQ(2, map["key"]);
+}
+
+TEST(TestFlatMap, Erase)
+{
+  CFlatMap<std::string, int> map;
+  map["a"] = 1;
+  map["b"] = 2;
+
+  EXPECT_EQ(0u, map.erase("c"));
+  EXPECT_EQ(1u, map.erase("a"));
+  ASSERT_EQ(1u, map.size());
+  EXPECT_EQ("b", map.cbegin()->first);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+// Run with --gtest_also_run_disabled_tests --gtest_filter=TestFlatMap.DISABLED_LibraryPayload
+// to compare the times of the JSON-RPC paths before and after changes to CFlatMap
+TEST(TestFlatMap, DISABLED_LibraryPayload)
+{
+  constexpr unsigned int MOVIES = 10000;
+  constexpr unsigned int RUNS = 10;
+
+  CVariant payload;
+  const double build = MeasureMilliseconds(RUNS, [&payload]() {
+    payload = CreateLibraryPayload(MOVIES);
+  });
+
+  std::string json;
+  const double write = MeasureMilliseconds(RUNS, [&payload, &json]() {
+    json.clear();
+    ASSERT_TRUE(CJSONVariantWriter::Write(payload, json, true));
+  });
+
+  CVariant parsed;
+  const double parse = MeasureMilliseconds(RUNS, [&json, &parsed]() {
+    parsed.clear();
+    ASSERT_TRUE(CJSONVariantParser::Parse(json, parsed));
+  });
+
+  unsigned int found = 0;
+  const double lookup = MeasureMilliseconds(RUNS, [&parsed, &found]() {
+    found = 0;
+    for (auto it = parsed["movies"].begin_array(); it != parsed["movies"].end_array(); ++it)
+    {
+      if ((*it)["streamdetails"]["video"][0]["width"].asInteger() == 3840 &&
+          !(*it)["file"].empty())
+        found++;
+    }
+  });
+
+  EXPECT_EQ(MOVIES, found);
+  EXPECT_EQ(MOVIES, parsed["limits"]["total"].asUnsignedInteger());
+
+  std::string written;
+  ASSERT_TRUE(CJSONVariantWriter::Write(parsed, written, true));
+  EXPECT_EQ(json, written);
+
+  std::cout << MOVIES << " movies, " << json.size() << " bytes of JSON, per run: build " << build
+            << " ms, write " << write << " ms, parse " << parse << " ms, lookup " << lookup
+            << " ms" << std::endl;
+}
@@ -9,6 +9,9 @@
 #include "utils/JSONVariantParser.h"
 #include "utils/Variant.h"
 
+#include <stdint.h>
+#include <string>
+
 #include <gtest/gtest.h>
 
 TEST(TestJSONVariantParser, CannotParseNullptr)
@@ -187,3 +190,123 @@ TEST(TestJSONVariantParser, CanParseArray)
   ASSERT_TRUE(variant[0]["foo"].isString());
   ASSERT_STREQ("bar", variant[0]["foo"].asString().c_str());
 }
+
+TEST(TestJSONVariantParser, CannotParseMalformedJson)
+{
+  CVariant variant;
+  ASSERT_FALSE(CJSONVariantParser::Parse("[ 1, 2, ]", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("{ \"foo\" \"bar\" }", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("{ \"foo\": \"bar\", }", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("{ 'foo': 'bar' }", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("\"foo", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("\"\\x\"", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("{} {}", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("01", variant));
+  ASSERT_FALSE(CJSONVariantParser::Parse("tru", variant));
+}
+
+TEST(TestJSONVariantParser, KeepsDataOnFailure)
+{
+  CVariant variant("foo");
+  ASSERT_FALSE(CJSONVariantParser::Parse("{ \"bar\": [ 1, 2 ", variant));
+  ASSERT_TRUE(variant.isString());
+  ASSERT_STREQ("foo", variant.asString().c_str());
+}
+
+TEST(TestJSONVariantParser, CanParseIntegerLimits)
+{
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(
+      "[ -9223372036854775808, 9223372036854775807, 18446744073709551615, 0, -0 ]", variant));
+  ASSERT_EQ(5U, variant.size());
+  ASSERT_TRUE(variant[0].isInteger());
+  ASSERT_EQ(INT64_MIN, variant[0].asInteger());
+  ASSERT_TRUE(variant[1].isInteger());
+  ASSERT_EQ(INT64_MAX, variant[1].asInteger());
+  ASSERT_TRUE(variant[2].isUnsignedInteger());
+  ASSERT_EQ(UINT64_MAX, variant[2].asUnsignedInteger());
+  ASSERT_TRUE(variant[3].isInteger());
+  ASSERT_EQ(0, variant[3].asInteger());
+  ASSERT_EQ(0, variant[4].asInteger());
+}
+
+TEST(TestJSONVariantParser, CanParseEscapedStrings)
+{
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(
+      "[ \"\\\"\\\\\\/\\b\\f\\n\\r\\t\", \"\\u00e9\\u20ac\\ud83d\\ude00\", \"a\\u0000b\" ]",
+      variant));
+  ASSERT_EQ(3U, variant.size());
+  ASSERT_STREQ("\"\\/\b\f\n\r\t", variant[0].asString().c_str());
+  ASSERT_STREQ("\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", variant[1].asString().c_str());
+  ASSERT_EQ(std::string("a\0b", 3), variant[2].asString());
+}
+
+TEST(TestJSONVariantParser, CanParseWhitespace)
+{
+  // long runs of whitespace are skipped in blocks on targets with SIMD support
+  const std::string space(100, ' ');
+  const std::string json = space + "{" + space + "\"foo\"\n\t\r :" + space + "[" +
+                           std::string(33, '\t') + "1" + std::string(17, '\n') + "," + space +
+                           "\" bar \"]" + space + "}" + space;
+
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(json, variant));
+  ASSERT_TRUE(variant["foo"].isArray());
+  ASSERT_EQ(2U, variant["foo"].size());
+  ASSERT_EQ(1, variant["foo"][0].asInteger());
+  ASSERT_STREQ(" bar ", variant["foo"][1].asString().c_str());
+}
+
+TEST(TestJSONVariantParser, CanParseNestedDocument)
+{
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse("{ \"jsonrpc\": \"2.0\", \"id\": 1, \"result\": { "
+                                        "\"limits\": { \"start\": 0, \"end\": 2, \"total\": 2 }, "
+                                        "\"movies\": [ { \"movieid\": 1, \"label\": \"a\", "
+                                        "\"art\": {}, \"cast\": [] }, { \"movieid\": 2, "
+                                        "\"label\": \"b\", \"art\": { \"poster\": \"p\" }, "
+                                        "\"cast\": [ null ] } ] } }",
+                                        variant));
+  ASSERT_STREQ("2.0", variant["jsonrpc"].asString().c_str());
+  ASSERT_EQ(1, variant["id"].asInteger());
+
+  const CVariant& result = variant["result"];
+  ASSERT_EQ(2, result["limits"]["total"].asInteger());
+  ASSERT_EQ(2U, result["movies"].size());
+  ASSERT_EQ(1, result["movies"][0]["movieid"].asInteger());
+  ASSERT_TRUE(result["movies"][0]["art"].isObject());
+  ASSERT_TRUE(result["movies"][0]["art"].empty());
+  ASSERT_TRUE(result["movies"][0]["cast"].isArray());
+  ASSERT_TRUE(result["movies"][0]["cast"].empty());
+  ASSERT_STREQ("b", result["movies"][1]["label"].asString().c_str());
+  ASSERT_STREQ("p", result["movies"][1]["art"]["poster"].asString().c_str());
+  ASSERT_EQ(1U, result["movies"][1]["cast"].size());
+  ASSERT_TRUE(result["movies"][1]["cast"][0].isNull());
+}
+
+TEST(TestJSONVariantParser, CanParseDeeplyNestedArrays)
+{
+  const unsigned int depth = 10000;
+  CVariant variant;
+  ASSERT_TRUE(
+      CJSONVariantParser::Parse(std::string(depth, '[') + std::string(depth, ']'), variant));
+
+  const CVariant* level = &variant;
+  for (unsigned int i = 1; i < depth; i++)
+  {
+    ASSERT_EQ(1U, level->size());
+    level = &(*level)[0];
+  }
+  ASSERT_TRUE(level->isArray());
+  ASSERT_TRUE(level->empty());
+}
+
+TEST(TestJSONVariantParser, KeepsLastOfDuplicateKeys)
+{
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse("{ \"foo\": 1, \"bar\": 2, \"foo\": 3 }", variant));
+  ASSERT_EQ(2U, variant.size());
+  ASSERT_EQ(3, variant["foo"].asInteger());
+  ASSERT_EQ(2, variant["bar"].asInteger());
+}
@@ -149,3 +149,59 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanStreamPieceByPiece)
+{
+  CVariant variant;
+  variant["foo"] = "bar";
+  variant["items"].push_back(1);
+  variant["items"].push_back(2);
+
+  for (bool compact : {true, false})
+  {
+    std::string expected;
+    ASSERT_TRUE(CJSONVariantWriter::Write(variant, expected, compact));
+
+    std::string str;
+    CJSONVariantStreamWriter writer(
+        [&str](const char* data, size_t size)
+        {
+          str.append(data, size);
+          return true;
+        },
+        compact);
+
+    ASSERT_TRUE(writer.StartObject());
+    ASSERT_TRUE(writer.Key("foo"));
+    ASSERT_TRUE(writer.Write(variant["foo"]));
+    ASSERT_TRUE(writer.Key("items"));
+    ASSERT_TRUE(writer.StartArray());
+    ASSERT_TRUE(writer.Write(variant["items"][0]));
+    ASSERT_TRUE(writer.Write(variant["items"][1]));
+    ASSERT_TRUE(writer.EndArray());
+    ASSERT_TRUE(writer.EndObject());
+    ASSERT_TRUE(writer.Flush());
+    ASSERT_TRUE(writer.IsComplete());
+    ASSERT_STREQ(expected.c_str(), str.c_str());
+  }
+}
+
+TEST(TestJSONVariantWriter, StreamStopsOnFailedOutput)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  for (int i = 0; i < 100000; i++)
+    variant.push_back("some text to fill the buffer");
+
+  int calls = 0;
+  CJSONVariantStreamWriter writer(
+      [&calls](const char* data, size_t size)
+      {
+        calls++;
+        return false;
+      },
+      true);
+
+  ASSERT_FALSE(writer.Write(variant));
+  ASSERT_FALSE(writer.Flush());
+  ASSERT_EQ(1, calls);
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/ParallelFor.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::UTILS;
+
+TEST(TestParallelFor, EveryIndexOnce)
+{
+  std::vector<std::atomic<int>> calls(100);
+  ParallelFor(calls.size(), 4, [&calls](size_t index) { calls[index]++; });
+
+  for (const auto& count : calls)
+    EXPECT_EQ(1, count);
+}
+
+TEST(TestParallelFor, Threads)
+{
+  std::atomic<int> running{0};
+  std::atomic<int> maxRunning{0};
+  ParallelFor(20, 3,
+              [&running, &maxRunning](size_t)
+              {
+                const int now = ++running;
+                int max = maxRunning;
+                while (now > max && !maxRunning.compare_exchange_weak(max, now))
+                  ;
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                running--;
+              });
+
+  EXPECT_LE(maxRunning, 3);
+  EXPECT_GE(maxRunning, 1);
+}
+
+TEST(TestParallelFor, CallingThread)
+{
+  // a single call, or a single thread, stays on the calling thread
+  std::set<std::thread::id> threads;
+  ParallelFor(5, 1, [&threads](size_t) { threads.insert(std::this_thread::get_id()); });
+  ASSERT_EQ(1u, threads.size());
+  EXPECT_EQ(std::this_thread::get_id(), *threads.begin());
+
+  ParallelFor(0, 4, [](size_t) { FAIL(); });
+}
@@ -0,0 +1,199 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "StreamDetailsCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/StackDirectory.h"
+#include "profiles/ProfileManager.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StreamDetails.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <stdexcept>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+constexpr int ENTRY_VERSION = 2;
+
+// the scanner probes in parallel while the info dialog or thumb loader may probe
+// the same file
+std::mutex entryFileMutex;
+} // namespace
+
+CStreamDetailsCache::CStreamDetailsCache()
+  : m_folder(
+        CServiceBroker::GetSettingsComponent()->GetProfileManager()->GetStreamDetailsFolder())
+{
+}
+
+CStreamDetailsCache::CStreamDetailsCache(std::string folder) : m_folder(std::move(folder))
+{
+}
+
+bool CStreamDetailsCache::GetKey(const std::string& path, Key& key)
+{
+  std::vector<std::string> files;
+  if (!URIUtils::IsStack(path))
+    files.emplace_back(path);
+  else if (!XFILE::CStackDirectory::GetPaths(path, files))
+    return false;
+
+  key.path = path;
+  key.files.clear();
+  for (const auto& file : files)
+  {
+    struct __stat64 st = {};
+    if (XFILE::CFile::Stat(file, &st) != 0 || st.st_size <= 0 || (st.st_mode & _S_IFDIR))
+      return false;
+
+    key.files.push_back({st.st_size, st.st_mtime});
+  }
+  return !key.files.empty();
+}
+
+bool CStreamDetailsCache::Load(const Key& key, CStreamDetails& details) const
+{
+  const std::string entryPath = GetEntryPath(key.path);
+
+  std::unique_lock<std::mutex> lock(entryFileMutex);
+  XFILE::CFile file;
+  if (!file.Open(entryPath))
+    return false;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+
+    Key stored;
+    if (!LoadKey(ar, stored) || stored.path != key.path || stored.files != key.files)
+      return false;
+
+    ar >> details;
+    return details.HasItems();
+  }
+  catch (const std::out_of_range&)
+  {
+    details.Reset();
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - corrupt entry for {}", __FUNCTION__,
+              CURL::GetRedacted(key.path));
+  }
+
+  return false;
+}
+
+bool CStreamDetailsCache::Save(const Key& key, CStreamDetails& details) const
+{
+  const std::string entryPath = GetEntryPath(key.path);
+
+  std::unique_lock<std::mutex> lock(entryFileMutex);
+  XFILE::CFile file;
+  if (!file.OpenForWrite(entryPath, true))
+  {
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - unable to write {}", __FUNCTION__, entryPath);
+    return false;
+  }
+
+  CArchive ar(&file, CArchive::store);
+  ar << ENTRY_VERSION;
+  ar << key.path;
+  ar << static_cast<int>(key.files.size());
+  for (const auto& stat : key.files)
+  {
+    ar << stat.size;
+    ar << stat.mtime;
+  }
+  ar << details;
+  ar.Close();
+  return true;
+}
+
+unsigned int CStreamDetailsCache::Clean() const
+{
+  CFileItemList items;
+  if (!XFILE::CDirectory::GetDirectory(m_folder, items, ".sdc", XFILE::DIR_FLAG_NO_FILE_DIRS))
+    return 0;
+
+  unsigned int removed = 0;
+  for (const auto& item : items)
+  {
+    if (item->m_bIsFolder)
+      continue;
+
+    Key stored;
+    {
+      std::unique_lock<std::mutex> lock(entryFileMutex);
+      XFILE::CFile file;
+      if (file.Open(item->GetPath()))
+      {
+        try
+        {
+          CArchive ar(&file, CArchive::load);
+          LoadKey(ar, stored);
+        }
+        catch (const std::out_of_range&)
+        {
+          stored.files.clear();
+        }
+      }
+    }
+
+    // unreadable entries and those of an older version are of no use either
+    Key current;
+    if (!stored.files.empty() && GetKey(stored.path, current) && current.files == stored.files)
+      continue;
+
+    std::unique_lock<std::mutex> lock(entryFileMutex);
+    if (XFILE::CFile::Delete(item->GetPath()))
+      removed++;
+  }
+
+  CLog::Log(LOGDEBUG, "CStreamDetailsCache::{} - removed {} of {} entries", __FUNCTION__, removed,
+            items.Size());
+  return removed;
+}
+
+bool CStreamDetailsCache::LoadKey(CArchive& ar, Key& key)
+{
+  int version;
+  ar >> version;
+  if (version != ENTRY_VERSION)
+    return false;
+
+  int count;
+  ar >> key.path;
+  ar >> count;
+  if (count <= 0)
+    return false;
+
+  key.files.resize(count);
+  for (auto& stat : key.files)
+  {
+    ar >> stat.size;
+    ar >> stat.mtime;
+  }
+  return true;
+}
+
+std::string CStreamDetailsCache::GetEntryPath(const std::string& path) const
+{
+  return URIUtils::AddFileToFolder(
+      m_folder, StringUtils::Format("{:08x}.sdc", Crc32::ComputeFromLowerCase(path)));
+}
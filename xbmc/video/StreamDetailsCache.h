@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class CArchive;
+class CStreamDetails;
+
+namespace KODI::VIDEO
+{
+/*!
+ \brief Persistent cache of the stream details probed from media files.
+
+ Probing a file opens the input stream and runs the full demuxer, which for files
+ on network shares takes several round trips. The result only depends on the file,
+ so it is stored per path together with the size and modification time of the
+ file, or of every part of a stack, and reused as long as they still match. Entries
+ of files that changed or are gone are removed when the video library is cleaned.
+ */
+class CStreamDetailsCache
+{
+public:
+  struct FileStat
+  {
+    int64_t size{0};
+    int64_t mtime{0};
+
+    bool operator==(const FileStat&) const = default;
+  };
+
+  struct Key
+  {
+    std::string path; ///< path the details were probed for, may be a stack
+    std::vector<FileStat> files; ///< the file, or every part of a stack
+  };
+
+  //! Cache in the stream details folder of the current profile
+  CStreamDetailsCache();
+  explicit CStreamDetailsCache(std::string folder);
+
+  /*!
+   \brief Get the cache key of a media file
+   \param path path the details are probed for, may be a stack
+   \param[out] key the key
+   \return false if a file can't be stat'ed or is a folder, its details are not cached then
+   */
+  static bool GetKey(const std::string& path, Key& key);
+
+  /*!
+   \brief Load the cached details of a file
+   \return false if there are none or the file changed since they were stored
+   */
+  bool Load(const Key& key, CStreamDetails& details) const;
+
+  bool Save(const Key& key, CStreamDetails& details) const;
+
+  /*!
+   \brief Remove the entries of files that changed or are gone
+   \return number of removed entries
+   */
+  unsigned int Clean() const;
+
+private:
+  std::string GetEntryPath(const std::string& path) const;
+  static bool LoadKey(CArchive& ar, Key& key);
+
+  std::string m_folder;
+};
+} // namespace KODI::VIDEO
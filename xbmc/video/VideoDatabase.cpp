@@ -54,6 +54,7 @@
 #include "utils/Variant.h"
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
+#include "video/StreamDetailsCache.h"
 #include "video/VideoDbUrl.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
@@ -10380,6 +10381,9 @@ void CVideoDatabase::CleanDatabase(CGUIDialogProgressBarHandle* handle,
 
       CUtil::DeleteVideoDatabaseDirectoryCache();
 
+      CLog::Log(LOGDEBUG, LOGDATABASE, "{}: Cleaning stream details cache", __FUNCTION__);
+      CStreamDetailsCache().Clean();
+
       auto end = std::chrono::steady_clock::now();
       auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
@@ -12852,16 +12856,21 @@ std::vector<std::string> CVideoDatabase::GetUsedImages(
       m_pDS->close();
     }
 
-    // then check any chapter thumbnails against path and file tables
+    // then check any chapter thumbnails and trickplay sprites against path and file tables
 
-    if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
-            CSettings::SETTING_MYVIDEOS_EXTRACTCHAPTERTHUMBS))
+    const bool chapterThumbs = CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+        CSettings::SETTING_MYVIDEOS_EXTRACTCHAPTERTHUMBS);
+    const bool trickplay =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoTrickplayOnScan;
+    if (chapterThumbs || trickplay)
     {
       std::vector<std::string> foundVideoFiles;
       for (const auto& image : imagesToCheck)
       {
         auto imageFile = IMAGE_FILES::CImageFileURL(image);
-        if (imageFile.GetSpecialType() == "video" && !imageFile.GetOption("chapter").empty())
+        if ((chapterThumbs && imageFile.GetSpecialType() == "video" &&
+             !imageFile.GetOption("chapter").empty()) ||
+            (trickplay && imageFile.GetSpecialType() == "trickplay"))
         {
           const auto& target = imageFile.GetTargetFile();
           auto quickFind = std::find(foundVideoFiles.begin(), foundVideoFiles.end(), target);
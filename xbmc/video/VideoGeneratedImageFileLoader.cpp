@@ -11,6 +11,7 @@
 #include "DVDFileInfo.h"
 #include "FileItem.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "URL.h"
 #include "filesystem/DirectoryCache.h"
 #include "guilib/Texture.h"
@@ -20,15 +21,23 @@
 #include "utils/URIUtils.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoTrickplay.h"
 
 #include <charconv>
+#include <cstring>
 
 namespace KODI::VIDEO
 {
 
 bool CVideoGeneratedImageFileLoader::CanLoad(const std::string& specialType) const
 {
-  return specialType == "video";
+  return specialType == "video" || specialType == "trickplay";
+}
+
+bool CVideoGeneratedImageFileLoader::IsCacheable(const IMAGE_FILES::CImageFileURL& imageFile) const
+{
+  // trickplay tiles are cut from the cached sprite
+  return imageFile.GetSpecialType() != "trickplay" || imageFile.GetOption("tile").empty();
 }
 
 namespace
@@ -53,6 +62,51 @@ void SetupRarOptions(CFileItem& item, const std::string& path)
     item.SetPath(url.Get());
   g_directoryCache.ClearDirectory(url.GetWithoutFilename());
 }
+
+int GetIntOption(const IMAGE_FILES::CImageFileURL& imageFile, const std::string& key)
+{
+  const std::string option = imageFile.GetOption(key);
+  int value = -1;
+  std::from_chars(option.data(), option.data() + option.size(), value);
+  return value;
+}
+
+std::unique_ptr<CTexture> LoadTrickplayTile(const std::string& filePath,
+                                            const TRICKPLAY::Layout& layout,
+                                            unsigned int tile)
+{
+  // tiles are cut from the cached sprite, generating it is left to whoever caches it as
+  // decoding the video for a preview would stall playback
+  bool needsRecaching = false;
+  const std::string sprite = CServiceBroker::GetTextureCache()->CheckCachedImage(
+      TRICKPLAY::GetSpriteURL(filePath), needsRecaching);
+  if (sprite.empty())
+    return {};
+
+  const std::unique_ptr<CTexture> texture = CTexture::LoadFromFile(sprite, 0, 0, true);
+  if (!texture || !texture->GetPixels() || texture->GetPitch() < texture->GetWidth() * 4)
+    return {};
+
+  // the image cache may have scaled the sprite down, the grid stays the same
+  const unsigned int rows = (layout.tiles + TRICKPLAY::COLUMNS - 1) / TRICKPLAY::COLUMNS;
+  const unsigned int tileWidth = texture->GetWidth() / TRICKPLAY::COLUMNS;
+  const unsigned int tileHeight = texture->GetHeight() / rows;
+  if (tileWidth == 0 || tileHeight == 0)
+    return {};
+
+  std::unique_ptr<CTexture> result = CTexture::CreateTexture(tileWidth, tileHeight);
+  result->SetAlpha(false);
+
+  const unsigned int x = (tile % TRICKPLAY::COLUMNS) * tileWidth;
+  const unsigned int y = (tile / TRICKPLAY::COLUMNS) * tileHeight;
+  for (unsigned int row = 0; row < tileHeight; row++)
+  {
+    std::memcpy(result->GetPixels() + row * result->GetPitch(),
+                texture->GetPixels() + (y + row) * texture->GetPitch() + x * 4, tileWidth * 4);
+  }
+
+  return result;
+}
 } // namespace
 
 std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
@@ -70,6 +124,23 @@ std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
   if (URIUtils::IsInRAR(filePath))
     SetupRarOptions(item, filePath);
 
+  if (imageFile.GetSpecialType() == "trickplay")
+  {
+    const int tile = GetIntOption(imageFile, "tile");
+    if (tile >= 0)
+    {
+      const int interval = GetIntOption(imageFile, "interval");
+      const int tiles = GetIntOption(imageFile, "tiles");
+      if (interval <= 0 || tile >= tiles)
+        return {};
+
+      const TRICKPLAY::Layout layout{interval, static_cast<unsigned int>(tiles)};
+      return LoadTrickplayTile(filePath, layout, static_cast<unsigned int>(tile));
+    }
+
+    return CDVDFileInfo::ExtractTrickplayToTexture(item, TRICKPLAY::GetStoredLayout(filePath));
+  }
+
   std::string chapterOption = imageFile.GetOption("chapter");
   int chapter = 0;
   std::from_chars(chapterOption.data(), chapterOption.data() + chapterOption.size(), chapter);
@@ -15,11 +15,15 @@ namespace KODI::VIDEO
 /*!
  * @brief Generates a texture for a thumbnail of a video file, for a specific chapter
  * or from a frame approx 1/3 into the video.
+ *
+ * Also generates the trickplay sprite of a video file, thumbnails at fixed intervals
+ * tiled into one image, and single tiles cut from that sprite for seek previews.
 */
 class CVideoGeneratedImageFileLoader : public IMAGE_FILES::ISpecialImageFileLoader
 {
 public:
   bool CanLoad(const std::string& specialType) const override;
+  bool IsCacheable(const IMAGE_FILES::CImageFileURL& imageFile) const override;
   std::unique_ptr<CTexture> Load(const IMAGE_FILES::CImageFileURL& imageFile) const override;
 };
 
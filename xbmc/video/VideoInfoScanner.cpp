@@ -17,6 +17,7 @@
 #include "URL.h"
 #include "Util.h"
 #include "VideoInfoDownloader.h"
+#include "cores/VideoPlayer/DVDDemuxers/KeyframeIndexJob.h"
 #include "cores/VideoPlayer/DVDFileInfo.h"
 #include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogProgress.h"
@@ -49,6 +50,7 @@
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoManagerTypes.h"
 #include "video/VideoThumbLoader.h"
+#include "video/VideoTrickplay.h"
 #include "video/VideoUtils.h"
 #include "video/dialogs/GUIDialogVideoManagerExtras.h"
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
@@ -463,6 +465,19 @@ namespace KODI::VIDEO
 
     m_database.Open();
 
+    std::vector<std::string> probePaths;
+    for (const auto& pItem : items)
+    {
+      if (pItem->m_bIsFolder)
+        continue;
+      if (content == CONTENT_MOVIES && m_database.HasMovieInfo(pItem->GetDynPath()))
+        continue;
+      if (content == CONTENT_MUSICVIDEOS && m_database.HasMusicVideoInfo(pItem->GetPath()))
+        continue;
+      probePaths.emplace_back(pItem->GetPath());
+    }
+    PrefetchStreamDetails(probePaths);
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     for (int i = 0; i < items.Size(); ++i)
@@ -1522,6 +1537,10 @@ namespace KODI::VIDEO
       }
     }
 
+    // indexing reads the whole file, so only when asked for
+    if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoKeyframeIndexOnScan)
+      CKeyframeIndexJob::Queue(*pItem);
+
     CLog::Log(LOGDEBUG, "VideoInfoScanner: Adding new item to {}:{}", TranslateContent(content), CURL::GetRedacted(pItem->GetPath()));
     long lResult = -1;
 
@@ -1635,6 +1654,13 @@ namespace KODI::VIDEO
       if ((libraryImport || advancedSettings->m_bVideoLibraryImportResumePoint) &&
           movieDetails.GetResumePoint().IsSet())
         m_database.AddBookMarkToFile(pItem->GetPath(), movieDetails.GetResumePoint(), CBookmark::RESUME);
+
+      // have the seek previews ready before the video is played for the first time, the
+      // sprite takes its layout from the stream details just stored
+      if (lResult > -1 && advancedSettings->m_videoTrickplayOnScan &&
+          TRICKPLAY::GetLayout(movieDetails.m_streamDetails.GetVideoDuration()).tiles > 0)
+        CServiceBroker::GetTextureCache()->BackgroundCacheImage(
+            TRICKPLAY::GetSpriteURL(pItem->GetDynPath()));
     }
 
     m_database.Close();
@@ -1919,6 +1945,14 @@ namespace KODI::VIDEO
       pDlgProgress->Progress();
     }
 
+    std::vector<std::string> probePaths;
+    for (const auto& file : files)
+    {
+      if (!file.isFolder && m_database.GetEpisodeId(file.strPath, file.iEpisode, file.iSeason) < 0)
+        probePaths.emplace_back(file.strPath);
+    }
+    PrefetchStreamDetails(probePaths);
+
     EPISODELIST episodes;
     bool hasEpisodeGuide = false;
 
@@ -2510,6 +2544,23 @@ namespace KODI::VIDEO
     return true;
   }
 
+  void CVideoInfoScanner::PrefetchStreamDetails(const std::vector<std::string>& paths)
+  {
+    // AddVideo only probes when asked for, and a single file is not worth the threads
+    if (paths.size() < 2 || !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                                CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
+      return;
+
+    const int threads =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoProbeThreads;
+    if (threads < 2)
+      return;
+
+    CLog::Log(LOGDEBUG, "VideoInfoScanner: Probing stream details of {} files with {} threads",
+              paths.size(), threads);
+    CDVDFileInfo::PrefetchFileStreamDetails(paths, threads, [this]() { return m_bStop; });
+  }
+
   bool CVideoInfoScanner::ProcessVideoVersion(VideoDbContentType itemType, int dbId)
   {
     return CGUIDialogVideoManagerVersions::ProcessVideoVersion(itemType, dbId);
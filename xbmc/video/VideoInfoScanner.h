@@ -242,6 +242,12 @@ namespace KODI::VIDEO
     bool AddVideoExtras(CFileItemList& items, const CONTENT_TYPE& content, const std::string& path);
     bool ProcessVideoVersion(VideoDbContentType itemType, int dbId);
 
+    /*! \brief Probe the stream details of the files about to be added in parallel.
+     The results are cached, so AddVideo doesn't have to probe them one at a time.
+     \param paths the files to probe.
+     */
+    void PrefetchStreamDetails(const std::vector<std::string>& paths);
+
     bool m_bStop;
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoTrickplay.h"
+
+#include "FileItem.h"
+#include "imagefiles/ImageFileURL.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoInfoTag.h"
+
+#include <algorithm>
+
+namespace KODI::VIDEO::TRICKPLAY
+{
+
+Layout GetLayout(int duration)
+{
+  if (duration < 2 * MIN_INTERVAL)
+    return {};
+
+  // spread the tiles over long videos instead of growing the sprite
+  const int maxTiles = static_cast<int>(MAX_TILES);
+  const int interval = std::max(MIN_INTERVAL, (duration + maxTiles - 1) / maxTiles);
+  const unsigned int tiles = static_cast<unsigned int>((duration + interval - 1) / interval);
+
+  return {interval, std::min(tiles, MAX_TILES)};
+}
+
+unsigned int GetTile(const Layout& layout, int time)
+{
+  if (layout.tiles == 0 || time <= 0)
+    return 0;
+
+  return std::min(static_cast<unsigned int>(time / layout.interval), layout.tiles - 1);
+}
+
+std::string GetSpriteURL(const std::string& path)
+{
+  return IMAGE_FILES::URLFromFile(path, "trickplay");
+}
+
+std::string GetTileURL(const std::string& path, const Layout& layout, unsigned int tile)
+{
+  auto url = IMAGE_FILES::CImageFileURL::FromFile(path, "trickplay");
+  url.AddOption("interval", std::to_string(layout.interval));
+  url.AddOption("tiles", std::to_string(layout.tiles));
+  url.AddOption("tile", std::to_string(tile));
+  return url.ToString();
+}
+
+Layout GetStoredLayout(const std::string& path)
+{
+  CVideoDatabase db;
+  if (!db.Open())
+    return {};
+
+  CFileItem item(path, false);
+  if (!db.GetStreamDetails(item))
+    return {};
+
+  return GetLayout(item.GetVideoInfoTag()->m_streamDetails.GetVideoDuration());
+}
+
+} // namespace KODI::VIDEO::TRICKPLAY
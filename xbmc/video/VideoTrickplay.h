@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace KODI::VIDEO::TRICKPLAY
+{
+
+/*!
+ \brief Layout of the trickplay sprite of a video.
+
+ The sprite holds one thumbnail per interval of the video, in rows of COLUMNS
+ tiles. Tiles are sized so the whole sprite fits the image cache resolution.
+ */
+struct Layout
+{
+  int interval{0}; //!< seconds between two tiles
+  unsigned int tiles{0}; //!< number of tiles
+};
+
+constexpr unsigned int COLUMNS = 10;
+constexpr unsigned int MAX_TILES = 100;
+constexpr unsigned int TILE_WIDTH = 128;
+constexpr int MIN_INTERVAL = 10;
+
+/*!
+ \brief Get the sprite layout for a video
+ \param duration length of the video in seconds
+ \return the layout, no tiles if the video is too short for previews
+ */
+Layout GetLayout(int duration);
+
+/*!
+ \brief Get the tile showing a time of the video
+ \param layout the sprite layout
+ \param time seconds into the video
+ \return index of the tile
+ */
+unsigned int GetTile(const Layout& layout, int time);
+
+/*!
+ \brief Get the image URL of the trickplay sprite of a video
+ \param path the video file
+
+ The sprite is keyed by the file only, its layout comes from the library, see
+ GetStoredLayout.
+ */
+std::string GetSpriteURL(const std::string& path);
+
+/*!
+ \brief Get the image URL of a single tile of the trickplay sprite of a video
+ \param path the video file
+ \param layout the layout of the sprite
+ \param tile index of the tile
+
+ Tiles are cut from the cached sprite and are not cached themselves, there is no
+ tile if the sprite is not cached.
+ */
+std::string GetTileURL(const std::string& path, const Layout& layout, unsigned int tile);
+
+/*!
+ \brief Get the layout of the trickplay sprite of a library video
+ \param path the video file
+ \return the layout, no tiles if the file is not in the library or too short for previews
+
+ The layout follows from the video duration in the stream details of the video
+ database, the sprite is generated with the same layout whoever asks for it.
+ */
+Layout GetStoredLayout(const std::string& path);
+
+} // namespace KODI::VIDEO::TRICKPLAY
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/StackDirectory.h"
+#include "test/TestUtils.h"
+#include "utils/StreamDetails.h"
+#include "utils/URIUtils.h"
+#include "video/StreamDetailsCache.h"
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+
+class TestStreamDetailsCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_file = XBMC_CREATETEMPFILE(".mkv");
+    ASSERT_NE(nullptr, m_file);
+    ASSERT_EQ(4, m_file->Write("data", 4));
+    m_file->Flush();
+    m_path = XBMC_TEMPFILEPATH(m_file);
+    m_folder = URIUtils::AddFileToFolder(CXBMCTestUtils::Instance().TempFileDirectory(m_file),
+                                         "streamdetails");
+    ASSERT_TRUE(XFILE::CDirectory::Create(m_folder));
+
+    CStreamDetailVideo* video = new CStreamDetailVideo();
+    video->m_iWidth = 1920;
+    video->m_iHeight = 1080;
+    video->m_strCodec = "h264";
+    video->m_iDuration = 5400;
+    m_details.AddStream(video);
+    m_details.DetermineBestStreams();
+  }
+
+  void TearDown() override
+  {
+    XFILE::CDirectory::RemoveRecursive(m_folder);
+    XBMC_DELETETEMPFILE(m_file);
+  }
+
+  XFILE::CFile* m_file{nullptr};
+  std::string m_path;
+  std::string m_folder;
+  CStreamDetails m_details;
+};
+
+TEST_F(TestStreamDetailsCache, RoundTrip)
+{
+  CStreamDetailsCache cache(m_folder);
+  CStreamDetailsCache::Key key;
+  ASSERT_TRUE(CStreamDetailsCache::GetKey(m_path, key));
+  ASSERT_EQ(1u, key.files.size());
+  EXPECT_EQ(4, key.files[0].size);
+
+  ASSERT_TRUE(cache.Save(key, m_details));
+
+  CStreamDetails details;
+  ASSERT_TRUE(cache.Load(key, details));
+  EXPECT_EQ("h264", details.GetVideoCodec());
+  EXPECT_EQ(1920, details.GetVideoWidth());
+  EXPECT_EQ(1080, details.GetVideoHeight());
+  EXPECT_EQ(5400, details.GetVideoDuration());
+}
+
+TEST_F(TestStreamDetailsCache, ChangedFile)
+{
+  CStreamDetailsCache cache(m_folder);
+  CStreamDetailsCache::Key key;
+  ASSERT_TRUE(CStreamDetailsCache::GetKey(m_path, key));
+  ASSERT_TRUE(cache.Save(key, m_details));
+
+  CStreamDetails details;
+  CStreamDetailsCache::Key changed = key;
+  changed.files[0].size++;
+  EXPECT_FALSE(cache.Load(changed, details));
+
+  changed = key;
+  changed.files[0].mtime++;
+  EXPECT_FALSE(cache.Load(changed, details));
+
+  changed = key;
+  changed.path += ".other";
+  EXPECT_FALSE(cache.Load(changed, details));
+}
+
+TEST_F(TestStreamDetailsCache, MissingFile)
+{
+  CStreamDetailsCache::Key key;
+  EXPECT_FALSE(CStreamDetailsCache::GetKey(m_path + ".missing", key));
+  EXPECT_FALSE(CStreamDetailsCache::GetKey(m_folder, key));
+}
+
+TEST_F(TestStreamDetailsCache, Stack)
+{
+  XFILE::CFile* part = XBMC_CREATETEMPFILE(".mkv");
+  ASSERT_NE(nullptr, part);
+  ASSERT_EQ(8, part->Write("moredata", 8));
+  part->Flush();
+  const std::string partPath = XBMC_TEMPFILEPATH(part);
+
+  std::string stack;
+  ASSERT_TRUE(XFILE::CStackDirectory::ConstructStackPath({m_path, partPath}, stack));
+
+  // every part is part of the key, not only the one that is probed
+  CStreamDetailsCache::Key key;
+  ASSERT_TRUE(CStreamDetailsCache::GetKey(stack, key));
+  ASSERT_EQ(2u, key.files.size());
+  EXPECT_EQ(4, key.files[0].size);
+  EXPECT_EQ(8, key.files[1].size);
+
+  XBMC_DELETETEMPFILE(part);
+  EXPECT_FALSE(CStreamDetailsCache::GetKey(stack, key));
+}
+
+TEST_F(TestStreamDetailsCache, Clean)
+{
+  CStreamDetailsCache cache(m_folder);
+  CStreamDetailsCache::Key key;
+  ASSERT_TRUE(CStreamDetailsCache::GetKey(m_path, key));
+  ASSERT_TRUE(cache.Save(key, m_details));
+
+  EXPECT_EQ(0u, cache.Clean());
+  CStreamDetails details;
+  EXPECT_TRUE(cache.Load(key, details));
+
+  ASSERT_EQ(4, m_file->Write("more", 4));
+  m_file->Flush();
+  EXPECT_EQ(1u, cache.Clean());
+  EXPECT_FALSE(cache.Load(key, details));
+}
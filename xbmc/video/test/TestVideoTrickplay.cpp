@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "imagefiles/ImageFileURL.h"
+#include "video/VideoTrickplay.h"
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+
+TEST(TestVideoTrickplay, Layout)
+{
+  EXPECT_EQ(0u, TRICKPLAY::GetLayout(0).tiles);
+  EXPECT_EQ(0u, TRICKPLAY::GetLayout(2 * TRICKPLAY::MIN_INTERVAL - 1).tiles);
+
+  // short videos get a tile per minimum interval
+  auto layout = TRICKPLAY::GetLayout(95);
+  EXPECT_EQ(TRICKPLAY::MIN_INTERVAL, layout.interval);
+  EXPECT_EQ(10u, layout.tiles);
+
+  // long videos spread the tiles
+  layout = TRICKPLAY::GetLayout(2 * 60 * 60);
+  EXPECT_EQ(72, layout.interval);
+  EXPECT_EQ(TRICKPLAY::MAX_TILES, layout.tiles);
+
+  layout = TRICKPLAY::GetLayout(2 * 60 * 60 + 1);
+  EXPECT_LE(layout.tiles, TRICKPLAY::MAX_TILES);
+  EXPECT_GE(static_cast<int>(layout.tiles) * layout.interval, 2 * 60 * 60 + 1);
+}
+
+TEST(TestVideoTrickplay, Tile)
+{
+  const auto layout = TRICKPLAY::GetLayout(95);
+  EXPECT_EQ(0u, TRICKPLAY::GetTile(layout, -5));
+  EXPECT_EQ(0u, TRICKPLAY::GetTile(layout, 9));
+  EXPECT_EQ(1u, TRICKPLAY::GetTile(layout, 10));
+  EXPECT_EQ(9u, TRICKPLAY::GetTile(layout, 95));
+  EXPECT_EQ(9u, TRICKPLAY::GetTile(layout, 200));
+}
+
+TEST(TestVideoTrickplay, URLs)
+{
+  const std::string path = "smb://server/share/movie.ts";
+  const auto layout = TRICKPLAY::GetLayout(95);
+
+  // the sprite does not depend on the duration reported by whoever asks for it
+  const IMAGE_FILES::CImageFileURL sprite(TRICKPLAY::GetSpriteURL(path));
+  EXPECT_EQ("trickplay", sprite.GetSpecialType());
+  EXPECT_EQ(path, sprite.GetTargetFile());
+  EXPECT_TRUE(sprite.GetOption("interval").empty());
+  EXPECT_TRUE(sprite.GetOption("tiles").empty());
+  EXPECT_TRUE(sprite.GetOption("tile").empty());
+
+  const IMAGE_FILES::CImageFileURL tile(TRICKPLAY::GetTileURL(path, layout, 3));
+  EXPECT_EQ(path, tile.GetTargetFile());
+  EXPECT_EQ("10", tile.GetOption("interval"));
+  EXPECT_EQ("10", tile.GetOption("tiles"));
+  EXPECT_EQ("3", tile.GetOption("tile"));
+}
@@ -17,9 +17,12 @@
 #include "guilib/GUIControlFactory.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUITextLayout.h"
+#include "guilib/GUITexture.h"
 #include "guilib/GUIWindowManager.h"
 #include "input/WindowTranslator.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CPUInfo.h"
@@ -28,6 +31,7 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
 CGUIWindowDebugInfo::CGUIWindowDebugInfo(void)
@@ -42,7 +46,8 @@ CGUIWindowDebugInfo::~CGUIWindowDebugInfo(void) = default;
 
 void CGUIWindowDebugInfo::UpdateVisibility()
 {
-  if (LOG_LEVEL_DEBUG_FREEMEM <= CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_logLevel || g_SkinInfo->IsDebugging())
+  if (LOG_LEVEL_DEBUG_FREEMEM <= CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_logLevel || g_SkinInfo->IsDebugging() ||
+      CGUIFrameProfiler::IsRunning())
     Open();
   else
     Close();
@@ -104,21 +109,19 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
     std::string lcAppName = CCompileInfo::GetAppName();
     StringUtils::ToLower(lcAppName);
 #if !defined(TARGET_POSIX)
-    info = StringUtils::Format("LOG: {}{}.log\nMEM: {}/{} KB - FPS: {:2.1f} fps\nCPU: {}{}",
-                               CSpecialProtocol::TranslatePath("special://logpath"), lcAppName,
-                               stat.availPhys / 1024, stat.totalPhys / 1024,
-                               CServiceBroker::GetGUI()
-                                   ->GetInfoManager()
-                                   .GetInfoProviders()
-                                   .GetSystemInfoProvider()
-                                   .GetFPS(),
-                               strCores, profiling);
+    info = StringUtils::Format(
+        "LOG: {}{}.log\nMEM: {}/{} KB - FPS: {:2.1f} fps - Draw calls: {} - Conditions: {}\nCPU: {}{}",
+        CSpecialProtocol::TranslatePath("special://logpath"), lcAppName, stat.availPhys / 1024,
+        stat.totalPhys / 1024,
+        CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetSystemInfoProvider().GetFPS(),
+        CServiceBroker::GetRenderSystem()->GetDrawCallsLastFrame(),
+        CServiceBroker::GetGUI()->GetInfoManager().GetEvaluationsLastFrame(), strCores, profiling);
 #else
     double dCPU = m_resourceCounter.GetCPUUsage();
     std::string ucAppName = lcAppName;
     StringUtils::ToUpper(ucAppName);
     info = StringUtils::Format("LOG: {}{}.log\n"
-                               "MEM: {}/{} KB - FPS: {:2.1f} fps\n"
+                               "MEM: {}/{} KB - FPS: {:2.1f} fps - Draw calls: {} - Conditions: {}\n"
                                "CPU: {} (CPU-{} {:4.2f}%{})",
                                CSpecialProtocol::TranslatePath("special://logpath"), lcAppName,
                                stat.availPhys / 1024, stat.totalPhys / 1024,
@@ -127,6 +130,8 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetInfoProviders()
                                    .GetSystemInfoProvider()
                                    .GetFPS(),
+                               CServiceBroker::GetRenderSystem()->GetDrawCallsLastFrame(),
+                               CServiceBroker::GetGUI()->GetInfoManager().GetEvaluationsLastFrame(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
   }
@@ -167,6 +172,15 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
     }
   }
 
+  if (CGUIFrameProfiler::IsRunning())
+  {
+    if (!info.empty())
+      info += "\n";
+    info += GetFrameProfilerInfo(currentTime);
+  }
+  else
+    m_frameTimes.clear();
+
   float w, h;
   if (m_layout->Update(info))
     MarkDirtyRegion();
@@ -175,6 +189,47 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
   float x = xShift + 0.04f * CServiceBroker::GetWinSystem()->GetGfxContext().GetWidth();
   float y = yShift + 0.04f * CServiceBroker::GetWinSystem()->GetGfxContext().GetHeight();
   m_renderRegion.SetRect(x, y, x+w, y+h);
+
+  // the frame time graph goes below the text, one pixel column per frame
+  m_graphRegion = CRect();
+  if (!m_frameTimes.empty())
+  {
+    m_graphRegion.SetRect(x, y + h + 10, x + 2.0f * CGUIFrameProfiler::MAX_FRAMES, y + h + 90);
+    m_renderRegion.Union(m_graphRegion);
+    MarkDirtyRegion();
+  }
+}
+
+std::string CGUIWindowDebugInfo::GetFrameProfilerInfo(unsigned int currentTime)
+{
+  const CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  m_frameTimes = profiler.GetFrameTimes();
+
+  float average = 0.0f;
+  float maximum = 0.0f;
+  for (const float frameTime : m_frameTimes)
+  {
+    average += frameTime;
+    maximum = std::max(maximum, frameTime);
+  }
+  if (!m_frameTimes.empty())
+    average /= m_frameTimes.size();
+
+  // ranking the controls walks the whole event buffer, don't do that every frame
+  if (currentTime - m_controlCostsTime >= 1000 || m_controlCosts.empty())
+  {
+    m_controlCostsTime = currentTime;
+    m_controlCosts.clear();
+    for (const auto& cost : profiler.GetControlCosts(60, 5))
+      m_controlCosts += StringUtils::Format(
+          "\n  {} ({}): {:.2f} ms", cost.controlId,
+          CGUIControlFactory::TranslateControlType(
+              static_cast<CGUIControl::GUICONTROLTYPES>(cost.controlType)),
+          cost.selfTime);
+  }
+
+  return StringUtils::Format("Frame: {:.1f} ms avg, {:.1f} ms max - Slowest controls:{}", average,
+                             maximum, m_controlCosts);
 }
 
 void CGUIWindowDebugInfo::Render()
@@ -187,5 +242,29 @@ void CGUIWindowDebugInfo::Render()
   CServiceBroker::GetWinSystem()->GetGfxContext().SetRenderingResolution(CServiceBroker::GetWinSystem()->GetGfxContext().GetResInfo(), false);
   if (m_layout)
     m_layout->RenderOutline(m_renderRegion.x1, m_renderRegion.y1, 0xffffffff, 0xff000000, 0, 0);
+
+  if (!m_graphRegion.IsEmpty())
+  {
+    CGraphicContext& context = CServiceBroker::GetWinSystem()->GetGfxContext();
+    CGUITexture::DrawQuad(m_graphRegion, 0x80000000);
+
+    // the graph covers two frame periods, frames above the line missed the refresh
+    const float fps = context.GetFPS();
+    const float period = fps > 0.0f ? 1000.0f / fps : 1000.0f / 60.0f;
+    const float scale = m_graphRegion.Height() / (2.0f * period);
+
+    float x = m_graphRegion.x1;
+    for (const float frameTime : m_frameTimes)
+    {
+      const float height = std::min(frameTime * scale, m_graphRegion.Height());
+      const KODI::UTILS::COLOR::Color color = frameTime > period * 1.5f ? 0xffff4040 : 0xff40ff40;
+      CGUITexture::DrawQuad(CRect(x, m_graphRegion.y2 - height, x + 2.0f, m_graphRegion.y2), color);
+      x += 2.0f;
+    }
+
+    const float target = m_graphRegion.y2 - period * scale;
+    CGUITexture::DrawQuad(CRect(m_graphRegion.x1, target, m_graphRegion.x2, target + 1.0f),
+                          0xffffffff);
+  }
   CServiceBroker::GetWinSystem()->GetGfxContext().SetRenderOrder(renderOrder);
 }
@@ -9,6 +9,10 @@
 #pragma once
 
 #include "guilib/GUIDialog.h"
+
+#include <string>
+#include <vector>
+
 #ifdef TARGET_POSIX
 #include "platform/posix/PosixResourceCounter.h"
 #endif
@@ -27,7 +31,13 @@ public:
 protected:
   void UpdateVisibility() override;
 private:
+  std::string GetFrameProfilerInfo(unsigned int currentTime);
+
   CGUITextLayout *m_layout;
+  std::vector<float> m_frameTimes;
+  CRect m_graphRegion;
+  std::string m_controlCosts;
+  unsigned int m_controlCostsTime = 0;
 #ifdef TARGET_POSIX
   CPosixResourceCounter m_resourceCounter;
 #endif